@@ -0,0 +1,99 @@
+#include "Bitset.h"
+
+
+	Bitset::Bitset(int n)
+	{
+		bit_count = n;
+		word_count = (n + 63) / 64;
+		if (word_count == 0) { word_count = 1; }
+		words = new unsigned long long[word_count];
+		clear_all();
+	}
+
+	Bitset::Bitset(const Bitset& cp)
+	{
+		bit_count = cp.bit_count;
+		word_count = cp.word_count;
+		words = new unsigned long long[word_count];
+		for (int w = 0; w < word_count; w++) { words[w] = cp.words[w]; }
+	}
+
+	Bitset::~Bitset()
+	{
+		delete[] words;
+	}
+
+	int Bitset::get(int i)
+	{
+		return (int) ((words[i >> 6] >> (i & 63)) & 1);
+	}
+
+	void Bitset::set(int i)
+	{
+		words[i >> 6] |= (1ULL << (i & 63));
+	}
+
+	void Bitset::clear(int i)
+	{
+		words[i >> 6] &= ~(1ULL << (i & 63));
+	}
+
+	void Bitset::clear_all()
+	{
+		for (int w = 0; w < word_count; w++) { words[w] = 0; }
+	}
+
+	int Bitset::count()
+	{
+		int c = 0;
+		for (int w = 0; w < word_count; w++) { c += __builtin_popcountll(words[w]); }
+		return c;
+	}
+
+	int Bitset::is_full()
+	{
+		return (count() == bit_count);
+	}
+
+	int Bitset::increment()
+	{
+		int w = 0;
+		while (w < word_count)
+		{
+			words[w]++;
+			if (words[w] != 0) { break; }
+			w++;
+		}
+		if (w == word_count) { return 0; }  // carried out of the top word.
+
+		// the top word only holds the bits below bit_count.
+		int top = bit_count - (64 * (word_count - 1));
+		if (top < 64 && (words[word_count-1] >> top) != 0) { clear_all();  return 0; }
+		return 1;
+	}
+
+	void Bitset::first_combination(int k)
+	{
+		clear_all();
+		for (int i = 0; i < k; i++) { set(i); }
+	}
+
+	// Move the lowest 1 that has a 0 above it up by one, and push the 1s below it back down to the bottom.
+	int Bitset::next_combination()
+	{
+		int i = 0;
+		while (i < bit_count && get(i) == 0) { i++; }
+		int j = i;
+		while (j < bit_count && get(j) == 1) { j++; }
+		if (j >= bit_count) { return 0; }
+
+		set(j);
+		for (int b = i; b < j; b++) { clear(b); }
+		for (int b = 0; b < j-i-1; b++) { set(b); }
+		return 1;
+	}
+
+	void Bitset::sprint(string& s)
+	{
+		for (int i = 0; i < bit_count; i++) { s.append( (get(i) == 1) ? "1" : "0" ); }
+	}
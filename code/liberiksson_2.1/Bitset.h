@@ -0,0 +1,48 @@
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <iostream.h>
+
+#include <string>
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is a fixed-size set of bits, stored in as many 64-bit words as
+// it needs, so that masks and subsets are not limited by the width of
+// a machine word.  Bit i is bit (i % 64) of words[i / 64], and the
+// bits past bit_count in the last word are always 0.
+//
+// Besides the usual operations, a Bitset can be stepped through all
+// 2^bit_count values as a binary counter (increment), or through all
+// of its subsets of a given size (first_combination, next_combination).
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class Bitset
+{
+	public:
+		int bit_count;
+		int word_count;
+		unsigned long long* words;
+
+		Bitset::Bitset(int n);  // n bits, all 0.
+		Bitset::Bitset(const Bitset& cp);
+		Bitset::~Bitset();
+
+		int Bitset::get(int i);
+		void Bitset::set(int i);
+		void Bitset::clear(int i);
+		void Bitset::clear_all();
+		int Bitset::count();  // the number of 1 bits.
+		int Bitset::is_full();  // 1 if every bit is 1.
+
+		int Bitset::increment();  // adds 1, as a bit_count-bit number.  Returns 0 (and wraps to all 0) after all 1s.
+		void Bitset::first_combination(int k);  // bits 0, ..., k-1.
+		int Bitset::next_combination();  // the next set with the same number of bits, in colex order, or 0 after the last.
+
+		void Bitset::sprint(string& s);
+};
+
+#endif
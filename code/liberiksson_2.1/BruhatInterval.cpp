@@ -0,0 +1,234 @@
+#include "BruhatInterval.h"
+
+
+	BruhatInterval::BruhatInterval(CoxeterElement& w)
+	{
+		coxeter_system = w.coxeter_system;
+		size = w.size;
+		top_length = w.length;
+
+		int* reduced = new int[top_length];
+		w.get_reduced_expression(reduced);
+
+		// subword closure, one letter of the reduced word at a time.
+		vector<NUMBERS_DATATYPE> all_words(size, 0);
+		vector<int> all_lengths(1, 0);
+		for (int i = 0; i < size; i++) { all_words[i] = 1; }
+
+		hash_slots = NULL;
+		hash_capacity = 0;
+		build_hash(all_words, 1);
+
+		NUMBERS_DATATYPE* v = new NUMBERS_DATATYPE[size];
+		for (int i = 0; i < top_length; i++)
+		{
+			int n = all_lengths.size();
+			for (int u = 0; u < n; u++)
+			{
+				for (int j = 0; j < size; j++) { v[j] = all_words[(size * u) + j]; }
+				int v_length = all_lengths[u] + coxeter_system->right_multiply_word(v, reduced[i]);
+
+				if (find_in(all_words, v) < 0)
+				{
+					all_words.insert(all_words.end(), v, v + size);
+					all_lengths.push_back(v_length);
+					if (2 * all_lengths.size() > hash_capacity) { build_hash(all_words, all_lengths.size()); }
+					else
+					{
+						int slot = (int) (hash_word(v) & (hash_capacity - 1));
+						while (hash_slots[slot] >= 0) { slot = (slot + 1) & (hash_capacity - 1); }
+						hash_slots[slot] = all_lengths.size() - 1;
+					}
+				}
+			}
+		}
+
+		// number the elements by length (a counting sort, stable within each length).
+		count = all_lengths.size();
+		level_start = new int[top_length+2];
+		for (int l = 0; l < top_length+2; l++) { level_start[l] = 0; }
+		for (int u = 0; u < count; u++) { level_start[ all_lengths[u]+1 ]++; }
+		for (int l = 0; l < top_length+1; l++) { level_start[l+1] += level_start[l]; }
+
+		words = new NUMBERS_DATATYPE[size * count];
+		lengths = new int[count];
+		int* next = new int[top_length+1];
+		for (int l = 0; l < top_length+1; l++) { next[l] = level_start[l]; }
+		for (int u = 0; u < count; u++)
+		{
+			int i = next[ all_lengths[u] ];
+			next[ all_lengths[u] ]++;
+			lengths[i] = all_lengths[u];
+			for (int j = 0; j < size; j++) { words[(size * i) + j] = all_words[(size * u) + j]; }
+		}
+		delete[] next;
+
+		vector<NUMBERS_DATATYPE> sorted_words(words, words + (size * count));
+		build_hash(sorted_words, count);
+
+		// right multiplication and descents.
+		products = new int[size * count];
+		descents = new unsigned long long[count];
+		for (int i = 0; i < count; i++)
+		{
+			descents[i] = 0;
+			for (int s = 0; s < size; s++)
+			{
+				if (words[(size * i) + s] < 0) { descents[i] |= (1ULL << s); }
+
+				for (int j = 0; j < size; j++) { v[j] = words[(size * i) + j]; }
+				coxeter_system->right_multiply_word(v, s);
+				products[(size * i) + s] = find(v);
+			}
+		}
+
+		// coatoms:  deleting one letter from a reduced word for y gives each element covered by y exactly once.
+		cover_start = new int[count+1];
+		vector<int> cover_list;
+		int* red = new int[top_length];
+		NUMBERS_DATATYPE* prefix = new NUMBERS_DATATYPE[size * (top_length+1)];
+		for (int y = 0; y < count; y++)
+		{
+			cover_start[y] = cover_list.size();
+			int len = get_reduced_expression(y, red);
+
+			for (int j = 0; j < size; j++) { prefix[j] = 1; }
+			for (int k = 0; k < len; k++)
+			{
+				for (int j = 0; j < size; j++) { prefix[(size * (k+1)) + j] = prefix[(size * k) + j]; }
+				coxeter_system->right_multiply_word(prefix + (size * (k+1)), red[k]);
+			}
+
+			for (int k = 0; k < len; k++)
+			{
+				for (int j = 0; j < size; j++) { v[j] = prefix[(size * k) + j]; }
+				int v_length = k;
+				for (int m = k+1; m < len; m++) { v_length += coxeter_system->right_multiply_word(v, red[m]); }
+
+				if (v_length == len-1) { cover_list.push_back(find(v)); }
+			}
+		}
+		cover_start[count] = cover_list.size();
+		covers = new int[cover_list.size() + 1];
+		for (int c = 0; c < cover_list.size(); c++) { covers[c] = cover_list[c]; }
+
+		delete[] red;
+		delete[] prefix;
+		delete[] v;
+		delete[] reduced;
+	}
+
+	BruhatInterval::~BruhatInterval()
+	{
+		delete[] words;
+		delete[] lengths;
+		delete[] level_start;
+		delete[] products;
+		delete[] descents;
+		delete[] cover_start;
+		delete[] covers;
+		delete[] hash_slots;
+	}
+
+	unsigned long long BruhatInterval::hash_word(NUMBERS_DATATYPE word[])
+	{
+		unsigned long long h = 14695981039346656037ULL;
+		for (int j = 0; j < size; j++) { h = (h ^ (unsigned long long) word[j]) * 1099511628211ULL; }
+		return h ^ (h >> 29);
+	}
+
+	// rebuild the hash table on the first n words, with room to grow.
+	void BruhatInterval::build_hash(vector<NUMBERS_DATATYPE>& all_words, int n)
+	{
+		if (hash_slots != NULL) { delete[] hash_slots; }
+
+		hash_capacity = 16;
+		while (hash_capacity < 4*n) { hash_capacity = 2 * hash_capacity; }
+		hash_slots = new int[hash_capacity];
+		for (int i = 0; i < hash_capacity; i++) { hash_slots[i] = -1; }
+
+		for (int u = 0; u < n; u++)
+		{
+			int slot = (int) (hash_word(&(all_words[size * u])) & (hash_capacity - 1));
+			while (hash_slots[slot] >= 0) { slot = (slot + 1) & (hash_capacity - 1); }
+			hash_slots[slot] = u;
+		}
+	}
+
+	int BruhatInterval::find_in(vector<NUMBERS_DATATYPE>& all_words, NUMBERS_DATATYPE word[])
+	{
+		int slot = (int) (hash_word(word) & (hash_capacity - 1));
+		while (hash_slots[slot] >= 0)
+		{
+			int u = hash_slots[slot];
+			int matches = 1;
+			for (int j = 0; j < size; j++)
+			{
+				if (all_words[(size * u) + j] != word[j]) { matches = 0; break; }
+			}
+			if (matches == 1) { return u; }
+			slot = (slot + 1) & (hash_capacity - 1);
+		}
+		return -1;
+	}
+
+	int BruhatInterval::find(NUMBERS_DATATYPE word[])
+	{
+		int slot = (int) (hash_word(word) & (hash_capacity - 1));
+		while (hash_slots[slot] >= 0)
+		{
+			int u = hash_slots[slot];
+			int matches = 1;
+			for (int j = 0; j < size; j++)
+			{
+				if (words[(size * u) + j] != word[j]) { matches = 0; break; }
+			}
+			if (matches == 1) { return u; }
+			slot = (slot + 1) & (hash_capacity - 1);
+		}
+		return -1;
+	}
+
+	int BruhatInterval::find(CoxeterElement& x)
+	{
+		if (x.length > top_length) { return -1; }
+		return find(x.word);
+	}
+
+	int BruhatInterval::get_count()
+	{
+		return count;
+	}
+
+	int BruhatInterval::get_level_size(int l)
+	{
+		if (l < 0 || l > top_length) { return 0; }
+		return level_start[l+1] - level_start[l];
+	}
+
+	int BruhatInterval::get_cover_count()
+	{
+		return cover_start[count];
+	}
+
+	// strip off right descents (lower elements stay in the interval), reading a reduced word backwards.
+	int BruhatInterval::get_reduced_expression(int i, int reduced[])
+	{
+		int len = lengths[i];
+		for (int k = len-1; k >= 0; k--)
+		{
+			int s = __builtin_ctzll(descents[i]);
+			reduced[k] = s;
+			i = products[(size * i) + s];
+		}
+		return len;
+	}
+
+	CoxeterElement BruhatInterval::get_element(int i)
+	{
+		int* reduced = new int[ lengths[i] ];
+		int len = get_reduced_expression(i, reduced);
+		CoxeterElement x = CoxeterElement(coxeter_system, reduced, len);
+		delete[] reduced;
+		return x;
+	}
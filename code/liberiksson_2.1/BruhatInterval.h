@@ -0,0 +1,64 @@
+#ifndef BRUHATINTERVAL_H
+#define BRUHATINTERVAL_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is the lower Bruhat interval [e, w], built from the subword 
+// property:  running through the reduced expression for w given by
+// get_reduced_expression(), the products of the subwords of each 
+// prefix are the products for the previous prefix together with 
+// these multiplied by the next letter.  Elements are identified by 
+// their numbers game words, through a hash table.
+//
+// The elements are then numbered 0, ..., count-1 by length, so the
+// elements of length l are level_start[l], ..., level_start[l+1]-1.
+// For each element we store right multiplication by each generator 
+// within the interval, its right descents, and the elements it covers
+// (its coatoms, found by deleting single letters from a reduced word) 
+// as an adjacency list:  covers[cover_start[i]], ..., 
+// covers[cover_start[i+1]-1].
+//
+// Generators are stored in the bits of an unsigned long long, so the
+// rank is at most 64.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class BruhatInterval
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		int size;
+		int top_length;  // the length of w.
+		int count;  // the number of elements in [e, w].
+
+		NUMBERS_DATATYPE* words;  // words[size*i + j] = entry j of the numbers game word of element i.
+		int* lengths;
+		int* level_start;  // top_length+2 entries.
+		int* products;  // products[size*i + s] = the number of element i times s, or -1 if it is not in the interval.
+		unsigned long long* descents;  // bit s of descents[i] is set if s is a right descent of element i.
+		int* cover_start;  // count+1 entries.
+		int* covers;
+
+		int* hash_slots;  // open addressing:  element numbers, or -1.
+		int hash_capacity;  // a power of 2.
+
+		BruhatInterval::BruhatInterval(CoxeterElement& w);
+		BruhatInterval::~BruhatInterval();
+
+		int BruhatInterval::get_count();
+		int BruhatInterval::get_level_size(int l);
+		int BruhatInterval::find(NUMBERS_DATATYPE word[]);  // the number of the element with this word, or -1.
+		int BruhatInterval::find(CoxeterElement& x);
+		int BruhatInterval::get_reduced_expression(int i, int reduced[]);  // writes a reduced word for element i, and returns its length.
+		CoxeterElement BruhatInterval::get_element(int i);
+		int BruhatInterval::get_cover_count();
+
+		unsigned long long BruhatInterval::hash_word(NUMBERS_DATATYPE word[]);
+		void BruhatInterval::build_hash(vector<NUMBERS_DATATYPE>& all_words, int n);
+		int BruhatInterval::find_in(vector<NUMBERS_DATATYPE>& all_words, NUMBERS_DATATYPE word[]);
+};
+
+#endif
@@ -0,0 +1,163 @@
+#include "CayleyTable.h"
+#include "GroupEnumerator.h"
+
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+// File layout:  magic, size, order, identity, Coxeter matrix, then the products, lengths and descents arrays.
+static const char CAYLEY_TABLE_MAGIC[8] = { 'C', 'A', 'Y', 'L', 'E', 'Y', '1', 0 };
+
+struct CayleyTableHeader
+{
+	char magic[8];
+	long long size;
+	long long order;
+	long long identity;
+};
+
+
+	CayleyTable::CayleyTable(ElementIndex* ei)
+	{
+		index = ei;
+		coxeter_system = index->coxeter_system;
+		size = coxeter_system->size;
+		order = index->get_order();
+		mapping = NULL;
+		mapping_size = 0;
+
+		if (size > 32) { cout << "ERROR:  Cayley tables support at most 32 generators." << endl;  order = 0; }
+
+		products = new int[size * order];
+		lengths = new int[order];
+		descents = new unsigned int[order];
+
+		CoxeterElement e = CoxeterElement(coxeter_system);
+		identity = index->rank(e);
+
+		// walk the group once, without copying elements.
+		GroupEnumerator elements(coxeter_system, 0);
+		while (elements.next())
+		{
+			CoxeterElement& w = elements.get_element();
+			long long r = index->rank(w);
+			lengths[r] = w.length;
+			descents[r] = 0;
+			for (int s = 0; s < size; s++)
+			{
+				if (w.has_right_descent(s)) { descents[r] |= (1U << s); }
+				products[(size * r) + s] = (int) index->right_multiply(w, r, s);
+			}
+		}
+	}
+
+	CayleyTable::CayleyTable(ElementIndex* ei, const char* filename)
+	{
+		index = ei;
+		coxeter_system = index->coxeter_system;
+		size = coxeter_system->size;
+		order = 0;
+		identity = 0;
+		products = NULL;
+		lengths = NULL;
+		descents = NULL;
+		mapping = NULL;
+		mapping_size = 0;
+
+		int fd = open(filename, O_RDONLY);
+		if (fd < 0) { return; }
+
+		struct stat st;
+		if (fstat(fd, &st) != 0 || st.st_size < sizeof(CayleyTableHeader)) { close(fd);  return; }
+
+		mapping_size = st.st_size;
+		void* m = mmap(NULL, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (m == MAP_FAILED) { mapping_size = 0;  return; }
+		mapping = (char*) m;
+
+		// only use the file if it was written for this Coxeter system.
+		CayleyTableHeader* header = (CayleyTableHeader*) mapping;
+		long long expected = sizeof(CayleyTableHeader) + (sizeof(int) * size * size) 
+			+ (sizeof(int) * size * index->get_order()) + (sizeof(int) * index->get_order()) + (sizeof(unsigned int) * index->get_order());
+		int matches = (memcmp(header->magic, CAYLEY_TABLE_MAGIC, 8) == 0) && (header->size == size) 
+			&& (header->order == index->get_order()) && (mapping_size == expected);
+
+		int* matrix = (int*) (mapping + sizeof(CayleyTableHeader));
+		for (int i = 0; matches && i < size*size; i++)
+		{
+			if (matrix[i] != coxeter_system->coxeter_matrix[i]) { matches = 0; }
+		}
+
+		if (matches == 0)
+		{
+			cout << "ERROR:  " << filename << " is not a Cayley table for this Coxeter system." << endl;
+			munmap(mapping, mapping_size);
+			mapping = NULL;
+			mapping_size = 0;
+			return;
+		}
+
+		order = header->order;
+		identity = header->identity;
+		products = matrix + (size * size);
+		lengths = products + (size * order);
+		descents = (unsigned int*) (lengths + order);
+	}
+
+	CayleyTable::~CayleyTable()
+	{
+		if (mapping != NULL) { munmap(mapping, mapping_size); }
+		else
+		{
+			if (products != NULL) { delete[] products; }
+			if (lengths != NULL) { delete[] lengths; }
+			if (descents != NULL) { delete[] descents; }
+		}
+	}
+
+	int CayleyTable::save(const char* filename)
+	{
+		if (order == 0) { return 0; }
+
+		ofstream out(filename, ios::out | ios::binary);
+		if (!out) { cout << "ERROR:  cannot write " << filename << "." << endl;  return 0; }
+
+		CayleyTableHeader header;
+		memcpy(header.magic, CAYLEY_TABLE_MAGIC, 8);
+		header.size = size;
+		header.order = order;
+		header.identity = identity;
+
+		out.write((char*) &header, sizeof(CayleyTableHeader));
+		out.write((char*) coxeter_system->coxeter_matrix, sizeof(int) * size * size);
+		out.write((char*) products, sizeof(int) * size * order);
+		out.write((char*) lengths, sizeof(int) * order);
+		out.write((char*) descents, sizeof(unsigned int) * order);
+		out.close();
+		return 1;
+	}
+
+	long long CayleyTable::right_multiply(long long r, int s)
+	{
+		return products[(size * r) + s];
+	}
+
+	int CayleyTable::has_right_descent(long long r, int s)
+	{
+		return (descents[r] >> s) & 1;
+	}
+
+	int CayleyTable::get_length(long long r)
+	{
+		return lengths[r];
+	}
+
+	void CayleyTable::sprint_reduced_expression(long long r, string& s)
+	{
+		CoxeterElement w = index->unrank(r);
+		w.sprint_reduced_expression(s);
+	}
@@ -0,0 +1,52 @@
+#ifndef CAYLEYTABLE_H
+#define CAYLEYTABLE_H
+
+#include "CoxeterElement.h"
+#include "ElementIndex.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is a dense multiplication table for a small finite Coxeter 
+// group:  for each element index r (see ElementIndex) and generator s
+// it stores the index of w s, together with the length of w and its 
+// right descents as a bitmask.  Multiplication by a generator is then
+// a single array lookup.
+//
+// The tables can be saved to a file and mapped back into memory (with
+// mmap) instead of being rebuilt.  Clients only build tables for groups
+// of order at most a threshold, by default CAYLEY_TABLE_DEFAULT_THRESHOLD
+// (D6, with 23040 elements, takes under 1 MB).
+//
+//////////////////////////////////////////////////////////////////////
+
+const long long CAYLEY_TABLE_DEFAULT_THRESHOLD = 1 << 20;
+
+class CayleyTable
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		ElementIndex* index;  // index is not allocated in this class.
+		int size;
+		long long order;  // 0 if the table could not be built or loaded.
+		long long identity;  // index of the identity element.
+
+		int* products;  // products[size*r + s] = index of w s, where w has index r.
+		int* lengths;  // lengths[r] = length of w.
+		unsigned int* descents;  // bit s of descents[r] is set if s is a right descent of w.
+
+		char* mapping;  // the mmapped file, or NULL if the tables were built in memory.
+		long long mapping_size;
+
+		CayleyTable::CayleyTable(ElementIndex* ei);  // build the tables.
+		CayleyTable::CayleyTable(ElementIndex* ei, const char* filename);  // map the tables from a file written by save().
+		CayleyTable::~CayleyTable();
+
+		int CayleyTable::save(const char* filename);  // returns 1 on success.
+
+		long long CayleyTable::right_multiply(long long r, int s);
+		int CayleyTable::has_right_descent(long long r, int s);
+		int CayleyTable::get_length(long long r);
+		void CayleyTable::sprint_reduced_expression(long long r, string& s);
+};
+
+#endif
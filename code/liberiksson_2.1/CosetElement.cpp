@@ -0,0 +1,141 @@
+#include "CosetElement.h"
+
+
+	// construct identity element
+	CosetElement::CosetElement(ParabolicChain* pc)
+	{
+		chain = pc;
+		size = chain->size;
+		digits = new int[size];
+		for (int k = 0; k < size; k++) { digits[k] = 0; }
+		length = 0;
+	}
+
+	// construct element with given reduced word
+	CosetElement::CosetElement(ParabolicChain* pc, int red[], int len)
+	{
+		chain = pc;
+		size = chain->size;
+		digits = new int[size];
+		for (int k = 0; k < size; k++) { digits[k] = 0; }
+		length = 0;
+
+		for (int i = 0; i < len; i++) { right_multiply(red[i]); }
+	}
+
+	CosetElement::CosetElement(const CosetElement& cp)
+	{
+		chain = cp.chain;
+		size = cp.size;
+		digits = new int[size];
+		for (int k = 0; k < size; k++) { digits[k] = cp.digits[k]; }
+		length = cp.length;
+	}
+
+	CosetElement::~CosetElement()
+	{
+		delete[] digits;
+	}
+
+	int CosetElement::equals(CosetElement* e)
+	{
+		if (e->length != length) { return 0; }
+		for (int k = 0; k < size; k++)
+		{
+			if (e->digits[k] != digits[k]) { return 0; }
+		}
+		return 1;
+	}
+
+	// exactly one digit changes, and the length changes by the difference in length of the coset representatives.
+	void CosetElement::right_multiply(int s)
+	{
+		int new_digit = 0;
+		int k = chain->find_transfer(digits, s, new_digit);
+		length += chain->coset_length[k][new_digit] - chain->coset_length[k][ digits[k] ];
+		digits[k] = new_digit;
+	}
+
+	int CosetElement::has_right_descent(int s)
+	{
+		int new_digit = 0;
+		int k = chain->find_transfer(digits, s, new_digit);
+		return (chain->coset_length[k][new_digit] < chain->coset_length[k][ digits[k] ]);
+	}
+
+	// reverse the reduced expression and replay it from the identity.
+	void CosetElement::invert()
+	{
+		int* reduced = new int[length];
+		get_reduced_expression(reduced);
+
+		int len = length;
+		for (int k = 0; k < size; k++) { digits[k] = 0; }
+		length = 0;
+		for (int i = len-1; i >= 0; i--) { right_multiply(reduced[i]); }
+
+		delete[] reduced;
+	}
+
+	// s w = (w^{-1} s)^{-1}
+	void CosetElement::left_multiply(int s)
+	{
+		invert();
+		right_multiply(s);
+		invert();
+	}
+
+	int CosetElement::has_left_descent(int s)
+	{
+		CosetElement v = CosetElement(*this);
+		v.invert();
+		return v.has_right_descent(s);
+	}
+
+	int CosetElement::get_length()
+	{
+		return length;
+	}
+
+	long long CosetElement::get_index()
+	{
+		return chain->get_index(digits);
+	}
+
+	void CosetElement::set_index(long long r)
+	{
+		chain->get_digits(r, digits);
+		length = 0;
+		for (int k = 0; k < size; k++) { length += chain->coset_length[k][ digits[k] ]; }
+	}
+
+	// the concatenation of reduced words for x_1, ..., x_n.
+	void CosetElement::get_reduced_expression(int reduced[])
+	{
+		int i = 0;
+		for (int k = 0; k < size; k++)
+		{
+			i += chain->get_coset_word(k, digits[k], reduced + i);
+		}
+	}
+
+	void CosetElement::print_reduced_expression()
+	{
+		int* reduced = new int[length];
+		get_reduced_expression(reduced);
+
+		cout << "( ";
+		for (int i = 0; i < length; i++) { cout << reduced[i] << " "; }
+		cout << ")";
+
+		delete[] reduced;
+	}
+
+	CoxeterElement CosetElement::get_coxeter_element()
+	{
+		int* reduced = new int[length];
+		get_reduced_expression(reduced);
+		CoxeterElement w = CoxeterElement(chain->coxeter_system, reduced, length);
+		delete[] reduced;
+		return w;
+	}
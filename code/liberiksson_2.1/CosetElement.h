@@ -0,0 +1,49 @@
+#ifndef COSETELEMENT_H
+#define COSETELEMENT_H
+
+#include "CoxeterElement.h"
+#include "ParabolicChain.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is a second representation of Coxeter elements, in the style
+// of du Cloux's "Coxeter" program:  w is stored as the tuple of its 
+// minimal coset representatives w = x_1 x_2 ... x_n along a 
+// ParabolicChain, so right multiplication by a generator is a few 
+// table lookups (rather than a numbers game move on every generator).
+//
+// Left multiplication and left descents go through the inverse, which
+// is rebuilt from a reduced word, so they cost O(length * rank).
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class CosetElement
+{
+	public:
+		ParabolicChain* chain;  // chain is not allocated in this class.
+		int size;
+		int* digits;  // digits[k] = index of x_{k+1} among the coset representatives at level k.
+		int length;
+
+		CosetElement::CosetElement(ParabolicChain* pc);  // construct identity element.
+		CosetElement::CosetElement(ParabolicChain* pc, int red[], int len);  // construct element with given reduced word.
+		CosetElement::CosetElement(const CosetElement& cp);
+		CosetElement::~CosetElement();
+
+		int CosetElement::equals(CosetElement* e);
+		void CosetElement::right_multiply(int s);
+		void CosetElement::left_multiply(int s);
+		void CosetElement::invert();
+		int CosetElement::has_right_descent(int s);
+		int CosetElement::has_left_descent(int s);
+
+		int CosetElement::get_length();
+		long long CosetElement::get_index();
+		void CosetElement::set_index(long long r);
+		void CosetElement::get_reduced_expression(int reduced[]);  // requires an array of length at least get_length().
+		void CosetElement::print_reduced_expression();
+		CoxeterElement CosetElement::get_coxeter_element();
+};
+
+#endif
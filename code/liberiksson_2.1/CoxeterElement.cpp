@@ -1,371 +1,525 @@
-#include "CoxeterElement.h"
-
-
-	// construct identity element
-	CoxeterElement::CoxeterElement(CoxeterSystem* cs)
-	{
-		coxeter_system = cs;
-		size = coxeter_system->size;
-
-		word = new int[size];
-		one_line = new int[size+1];
-		for (int i = 0; i < size; i++)
-		{
-			word[i] = 1;
-			one_line[i] = i+1;
-		}
-		one_line[size] = size+1;
-
-		length = 0;
-	}
-
-	// from 1-line.
-	CoxeterElement::CoxeterElement(CoxeterSystem* cs, int w[], int ol[])
-	{
-		coxeter_system = cs;
-		size = coxeter_system->size;
-		word = new int[size];
-		one_line = new int[size+1];
-		for (int i = 0; i < size; i++)
-		{ word[i] = w[i]; one_line[i] = ol[i]; }
-		one_line[size] = ol[size];
-		length = get_length();
-	}
-
-	// from reduced expression
-	CoxeterElement::CoxeterElement(CoxeterSystem* cs, int red[], int len)
-	{
-		coxeter_system = cs;
-		size = coxeter_system->size;
-		word = new int[size];
-		one_line = new int[size+1];
-		for (int i = 0; i < size; i++)
-		{
-			word[i] = 1;
-			one_line[i] = i+1;
-		}
-		one_line[size] = size+1;
-		length = 0;
-
-		for (int i = 0; i < len; i++)
-		{ right_multiply(red[i]); }
-	}
-
-	// copy constructor
-	CoxeterElement::CoxeterElement(const CoxeterElement& cp)
-	{
-		coxeter_system = cp.coxeter_system;
-		size = coxeter_system->size;
-
-		word = new int[size];
-		one_line = new int[size+1];
-		for (int i = 0; i < size; i++)
-		{
-			word[i] = cp.word[i];
-			one_line[i] = cp.one_line[i];
-		}
-		one_line[size] = cp.one_line[size];
-
-		length = cp.length;
-	}
-
-	//CoxeterElement::operator=(const CoxeterElement& cp);   // = operator copy-constructor: for passing by reference in functions and creating copies on the heap.
-
-	int CoxeterElement::equals(CoxeterElement* cp)
-	{
-		if (cp->size != this->size) { return 0; }
-		int ret = 1;
-		for (int i = 0; i < this->size; i++)
-		{
-			if (cp->word[i] != this->word[i]) { ret = 0; }
-		}
-		return ret;
-	}
-
-	void CoxeterElement::print()
-	{
-		cout << "[ ";
-		for (int i = 0 ; i < size; i++ ) { cout << word[i] << " "; }
-		cout << "]";
-
-		cout << " { ";
-		for (int i = 0 ; i < size+1; i++ ) { cout << one_line[i] << " "; }
-		cout << "}";
-	}
-
-	void CoxeterElement::print_reduced_expression()
-	{
-		int* r = new int[length];
-		get_reduced_expression(r);
-		cout << "( ";
-		for (int i = 0; i < length; i++)
-		{ cout << r[i] << " "; }
-		cout << ")";
-		delete[] r;
-	}
-
-	void CoxeterElement::sprint_reduced_expression(string& s)
-	{
-		int* r = new int[length];
-		get_reduced_expression(r);
-		s.append( "( " );
-		for (int i = 0; i < length; i++)
-		{ 
- 			//s.append( itoa(r[i]) );
-			char str[255];
-			sprintf(str, "%d", r[i]);
-			s.append( str ); 
-			s.append( " " ); 
-		}
-		s.append( ")" );
-		delete[] r;
-	}
-
-	int CoxeterElement::has_right_ascent(int s)
-	{
-		CoxeterElement t = *this;  // using copy-constructor, t is on the heap...
-		t.right_multiply(s);
-		return (t.length > length);
-
-		// optimization:  there should be a way to say "if type A, return whether the oneline entry is negative or positive."
-	}
-
-	int CoxeterElement::has_right_descent(int s)
-	{
-		CoxeterElement t = *this;  // using copy-constructor, t is on the heap...
-		t.right_multiply(s);
-		return (t.length < length);
-	}
-
-	void CoxeterElement::right_multiply(int s)
-	{
-		for (int i = 0; i < size; i++)
-		{
-			if (coxeter_system->get_exponent(s,i) == 0) { word[i] = word[i]; }  // do nothing.
-			else if (coxeter_system->get_exponent(s,i) == 2) { word[i] = word[i]; }  // commutes so do nothing.
-			else if (coxeter_system->get_exponent(s,i) == 3) { word[i] = word[s] + word[i]; }
-			else if (coxeter_system->get_exponent(s,i) == 4) { word[i] = (2*word[s]) + word[i]; }
-			else if (coxeter_system->get_exponent(s,i) == 6) { word[i] = (3*word[s]) + word[i]; }
-			else if (coxeter_system->get_exponent(s,i) == -1) { word[i] = (2*word[s]) + word[i]; }  // meaning infinity
-			else { word[i] = 0; cout << "ERROR:  coxeter matrix entry " << coxeter_system->get_exponent(s,i) << " not supported." << endl; } 
-		}
-
-		if ( word[s] > 0 ) { length++; } else { length--; }
-
-		word[s] = 0 - word[s];
-
-		// perform type-dependent multiplication on one_line.
-		coxeter_system->right_multiply(one_line, s);
-	}
-
-	// WARNING:  left multiplication is not optimized.
-	void CoxeterElement::left_multiply(int s)
-	{
-		int* reduced = new int[ length ];
-		get_reduced_expression(reduced);
-
-		CoxeterElement t = CoxeterElement(coxeter_system);
-		int count_moves = 1;
-		t.right_multiply(s);
-		for (int i = 0; i < length; i++)
-		{
-			if (t.word[ reduced[i] ] > 0) { count_moves++; } else { count_moves--; }
-			t.right_multiply(reduced[i]);
-		}
-
-		for (int i = 0; i < size; i++)
-		{
-			word[i] = t.word[i];
-			one_line[i] = t.one_line[i];
-		}
-		one_line[size] = t.one_line[size];
-		length = count_moves;
-
-		delete [] reduced;
-	}
-
-	int CoxeterElement::get_length()
-	{
-		int count_moves = 0;
-		get_reduced_expression(NULL, count_moves);
-		return count_moves;
-	}
-
-	void CoxeterElement::get_reduced_expression(int reduced[])
-	{
-		int c = 0;
-		get_reduced_expression(reduced, c);
-	}
-
-	// requires an allocated array of length at least this->length.
-	void CoxeterElement::get_reduced_expression(int reduced[], int& count_moves)
-	{
-		count_moves = 0;
-
-		CoxeterElement t = *this;  // using copy-constructor, t is on the heap...
-		
-		while (1==1)
-		{
-			int move = 0;
-			for (move = 0; move < size; move++)
-			{
-				if (t.word[move] < 0) { break; }
-			}
-
-			if (move >= size) { break; }
-
-			if (reduced != NULL) { reduced[length-1-count_moves] = move; }
-			count_moves++;
-			t.right_multiply(move);
-		}
-	}
-
-	int CoxeterElement::get_rank(int reduced[])
-	{
-		vector<int> support;
-		
-		for (int i = 0; i < length; i++)
-		{
-			int contains = 0;
-			for (int j = 0; j < support.size(); j++)
-			{ 
-				if (support[j] == reduced[i]) { contains = 1; } 
-			}
-			if (contains == 0) { support.push_back( reduced[i] ); }
-		}
-
-		return support.size();
-	}
-
-	CoxeterElement::~CoxeterElement()
-	{
-		delete[] word;
-		delete[] one_line;
-	}
-
-	void CoxeterElement::print_heap()
-	{
-		int* reduced = new int[ length ];
-		get_reduced_expression(reduced);
-
-		int level[length];
-		for (int i = 0; i < length; i++) { level[i] = 0; }
-
-		int heap[size];
-		for (int i = 0; i < size; i++) { heap[i] = 0; }
-
-		cout << "length : " << length << endl;
-		for (int i = 0; i < length; i++) { cout << reduced[i] << " "; }
-		cout << endl;
-
-		for (int i = 0; i < length; i++)
-		{
-			for ( int m = 0 ; m < size; m++ )
-			{
-				if (this->coxeter_system->get_exponent(m, reduced[i]) >= 3) 
-				{ heap[m] = heap[reduced[i]]+1; }
-			}
-
-			level[ i ] = heap[reduced[i]];
-		}
-
-		cout << endl;
-
-		for (int le = length-1; le >= 0; le--)
-		{
-			for (int seek = 0 ; seek < size; seek++)
-			{
-				int found = 0;
-				for (int i = 0; i < length; i++)
-				{
-				if (level[i] == le && reduced[i] == seek) { cout <<  "* ";  found = 1; }
-				}
-
-				if (found == 0) { cout << "  "; }
-	 		}
-			cout << endl;
-		}
-
-		// add coalescing code?  For each entry, l->r if there is nothing immediately above (but there is eventually), then move the elt up.
-
-		cout << endl;
-	}
-
-
-	// This checks type A, B, D-style one_line pattern containment:  i.e. the bars must be in the same position, and the digits flatten.
-	// Currently only used/extensively tested with type D.  There is a size difference in the one_line array for type A.
-	// To optimize, we should really only calculate the flattening of w once, and check the entire _list_ of patterns inside the loop.  However, the patterns are not all the same size.
-	int CoxeterElement::contains_one_line_pattern(CoxeterElement& pattern)
-	{
-		// look at all subwords of size pattern->size in this.
-		// see if they flatten to the first pattern->size entries of pattern, with the same bar pattern.
-		int any_match = 0;
-		
-		int k = pattern.size;
-
-		long lower_swm = 0;
-		for (int i = 0; i < k; i++ ) { lower_swm = lower_swm + (long) pow(2.0, (double) i); }
-		long upper_swm = 0;
-		for (int i = 1; i <= k; i++ ) { upper_swm = upper_swm + (long) pow(2.0, (double) ((this->size)-i)); }
-
-		for (long swm = lower_swm; swm <= upper_swm; swm++)
-		{
-			// make sure there are exactly k positions.
-			int on = 0;
-			for (int ii = 0; ii < 32-1; ii++) { if ( ((swm >> ii) & 1) == 1 ) { on++; } }
-			if ( on != k ) { continue; }
-
-			// map to indicies to get subword.
-			int* sub_one_line = new int[ k ];
-			int iii=0;
-			for (int ii = 0; ii < 32-1; ii++) { if ( ((swm >> ii) & 1) == 1 ) { sub_one_line[iii] = ii; iii++; } }
-
-			// flatten and test.
-			int* flattened = new int[k];
-			for (int i = 0; i < k; i++) { flattened[i] = 0; }
-			int next_digit = 1;
-			for (int search_for = 1; search_for <= this->size; search_for++)
-			{
-			  for (int i = 0; i < k; i++)
-			  {
-				  if (abs(this->one_line[ sub_one_line[i] ]) == search_for)
-				  {
-					  flattened[i] = next_digit;
-					  if (this->one_line[ sub_one_line[i] ] < 0) { flattened[i] = 0 - flattened[i]; }
-					  next_digit++;
-				  }
-			  }
-			}
-
-			int matches = 1;
-			for (int i = 0; i < k; i++)
-			{
-				if (flattened[i] != pattern.one_line[i]) { matches = 0; }
-			}
-
-			// test output.
-			if (matches == 1) { any_match = 1;  if (DEBUG_VERBOSE) { cout << " (one_line pattern match on "; pattern.print(); cout << ") " << endl; }  break; }
-			 
-			if (DEBUG_VERBOSE)
-			{	
-			  cout << "n = " << this->size << " k = " << k << " : " << lower_swm << " to " << upper_swm << ": ";
-			  for (int ii = 0; ii < 32-1; ii++) { cout << ((swm >> ii) & 1); }
-			  cout << " : ";
-			  for (int i = 0; i < k; i++) { cout << sub_one_line[i]; }
-			  cout << " : ";
-			  for (int i = 0; i < k; i++) { cout << flattened[i]; }
-			  cout << "  Match on "; pattern.print(); cout << " : " << matches << endl;
-			}
-		}
-
-		return any_match;
-	}
-
-
-//////////////////////////////////////////////////////////////////////
-//
-//  End of eriksson library code.
-//
-//////////////////////////////////////////////////////////////////////
-
-
+#include "CoxeterElement.h"
+#include "Bitset.h"
+
+
+	// construct identity element
+	CoxeterElement::CoxeterElement(CoxeterSystem* cs)
+	{
+		coxeter_system = cs;
+		size = coxeter_system->size;
+
+		word = new NUMBERS_DATATYPE[size];
+		one_line = new int[size+1];
+		for (int i = 0; i < size; i++)
+		{
+			word[i] = 1;
+			one_line[i] = i+1;
+		}
+		one_line[size] = size+1;
+
+		length = 0;
+		fingerprint = coxeter_system->get_fingerprint(word);
+
+		heap_state = new int[3*size];
+		clear_heap_state();
+	}
+
+	// from 1-line.
+	CoxeterElement::CoxeterElement(CoxeterSystem* cs, NUMBERS_DATATYPE w[], int ol[])
+	{
+		coxeter_system = cs;
+		size = coxeter_system->size;
+		word = new NUMBERS_DATATYPE[size];
+		one_line = new int[size+1];
+		for (int i = 0; i < size; i++)
+		{ word[i] = w[i]; one_line[i] = ol[i]; }
+		one_line[size] = ol[size];
+		heap_state = new int[3*size];
+		heap_valid = 0;
+		length = get_length();
+		fingerprint = coxeter_system->get_fingerprint(word);
+	}
+
+	// from reduced expression
+	CoxeterElement::CoxeterElement(CoxeterSystem* cs, int red[], int len)
+	{
+		coxeter_system = cs;
+		size = coxeter_system->size;
+		word = new NUMBERS_DATATYPE[size];
+		one_line = new int[size+1];
+		for (int i = 0; i < size; i++)
+		{
+			word[i] = 1;
+			one_line[i] = i+1;
+		}
+		one_line[size] = size+1;
+		length = 0;
+		fingerprint = coxeter_system->get_fingerprint(word);
+
+		heap_state = new int[3*size];
+		clear_heap_state();
+
+		for (int i = 0; i < len; i++)
+		{ right_multiply(red[i]); }
+	}
+
+	// copy constructor
+	CoxeterElement::CoxeterElement(const CoxeterElement& cp)
+	{
+		coxeter_system = cp.coxeter_system;
+		size = coxeter_system->size;
+
+		word = new NUMBERS_DATATYPE[size];
+		one_line = new int[size+1];
+		for (int i = 0; i < size; i++)
+		{
+			word[i] = cp.word[i];
+			one_line[i] = cp.one_line[i];
+		}
+		one_line[size] = cp.one_line[size];
+
+		length = cp.length;
+		fingerprint = cp.fingerprint;
+
+		heap_state = new int[3*size];
+		for (int i = 0; i < 3*size; i++) { heap_state[i] = cp.heap_state[i]; }
+		heap_valid = cp.heap_valid;
+	}
+
+	//CoxeterElement::operator=(const CoxeterElement& cp);   // = operator copy-constructor: for passing by reference in functions and creating copies on the heap.
+
+	int CoxeterElement::equals(CoxeterElement* cp)
+	{
+		if (cp->size != this->size) { return 0; }
+		if (cp->fingerprint != this->fingerprint) { return 0; }
+		int ret = 1;
+		for (int i = 0; i < this->size; i++)
+		{
+			if (cp->word[i] != this->word[i]) { ret = 0; }
+		}
+		return ret;
+	}
+
+	// Use the one-line notation when the type has a criterion for it, and the (memoized) descent recursion otherwise.
+	int CoxeterElement::bruhat_leq(CoxeterElement& w)
+	{
+		if (length > w.length) { return 0; }
+		if (length == w.length) { return equals(&w); }
+		if (length == 0) { return 1; }
+
+		int leq = coxeter_system->bruhat_leq_one_line(one_line, w.one_line);
+		if (leq >= 0) { return leq; }
+
+		leq = coxeter_system->lookup_bruhat(word, w.word);
+		if (leq >= 0) { return leq; }
+
+		leq = coxeter_system->bruhat_leq_words(word, length, w.word, w.length);
+		coxeter_system->store_bruhat(word, w.word, leq);
+		return leq;
+	}
+
+	void CoxeterElement::print()
+	{
+		cout << "[ ";
+		for (int i = 0 ; i < size; i++ ) { string n;  coxeter_system->sprint_number(word[i], n);  cout << n << " "; }
+		cout << "]";
+
+		if (coxeter_system->track_one_line == 0) { return; }
+		cout << " { ";
+		for (int i = 0 ; i < size+1; i++ ) { cout << one_line[i] << " "; }
+		cout << "}";
+	}
+
+	void CoxeterElement::print_reduced_expression()
+	{
+		int* r = new int[length];
+		get_reduced_expression(r);
+		cout << "( ";
+		for (int i = 0; i < length; i++)
+		{ cout << r[i] << " "; }
+		cout << ")";
+		delete[] r;
+	}
+
+	void CoxeterElement::sprint_reduced_expression(string& s)
+	{
+		int* r = new int[length];
+		get_reduced_expression(r);
+		s.append( "( " );
+		for (int i = 0; i < length; i++)
+		{ 
+ 			//s.append( itoa(r[i]) );
+			char str[255];
+			sprintf(str, "%d", r[i]);
+			s.append( str ); 
+			s.append( " " ); 
+		}
+		s.append( ")" );
+		delete[] r;
+	}
+
+	// right_multiply increases the length exactly when the entry at s is positive, so no copy is needed.
+	int CoxeterElement::has_right_ascent(int s)
+	{
+		return (word[s] > 0);
+	}
+
+	int CoxeterElement::has_right_descent(int s)
+	{
+		return (word[s] < 0);
+	}
+
+	int CoxeterElement::right_extension_avoids_short_braid(int s)
+	{
+		if (heap_valid == 0) { build_heap_state(); }
+		return (heap_state[s] < 0 || heap_state[s] >= 2);
+	}
+
+	int CoxeterElement::left_extension_avoids_short_braid(int s)
+	{
+		if (heap_valid == 0) { build_heap_state(); }
+		return (heap_state[size+s] < 0 || heap_state[size+s] >= 2);
+	}
+
+	// heap state of the identity.
+	void CoxeterElement::clear_heap_state()
+	{
+		for (int i = 0; i < size; i++)
+		{
+			heap_state[i] = -1;
+			heap_state[size+i] = -1;
+			heap_state[2*size+i] = 0;
+		}
+		heap_valid = 1;
+	}
+
+	// adds s to the top (on_right == 1) or bottom (on_right == 0) of the heap.  Only the generators adjacent to s change.
+	void CoxeterElement::update_heap_state(int s, int on_right)
+	{
+		int* near = heap_state;  // counts on the side s is added to.
+		int* far = heap_state + size;  // counts on the other side.
+		if (on_right == 0) { near = heap_state + size;  far = heap_state; }
+		int* occurrences = heap_state + 2*size;
+
+		int d = coxeter_system->get_degree(s);
+
+		// the first occurrence of s is also the last occurrence from the other side, and sees every neighbor already placed.
+		if (occurrences[s] == 0)
+		{
+			int c = 0;
+			for (int k = 0; k < d; k++) { c = c + occurrences[ coxeter_system->get_neighbor(s,k) ]; }
+			far[s] = (c > 2) ? 2 : c;
+		}
+		if (occurrences[s] < 2) { occurrences[s]++; }
+
+		near[s] = 0;
+		for (int k = 0; k < d; k++)
+		{
+			int t = coxeter_system->get_neighbor(s,k);
+			if (near[t] >= 0 && near[t] < 2) { near[t]++; }
+		}
+	}
+
+	// replay the reduced expression from the identity.
+	void CoxeterElement::build_heap_state()
+	{
+		int* reduced = new int[ length ];
+		get_reduced_expression(reduced);
+
+		clear_heap_state();
+		for (int i = 0; i < length; i++) { update_heap_state(reduced[i], 1); }
+
+		delete [] reduced;
+	}
+
+	void CoxeterElement::right_multiply(int s)
+	{
+		// generators commuting with s are unchanged, so only the neighbors of s are visited.
+		unsigned long long* keys = coxeter_system->fingerprint_keys;
+		for (int k = 0; k < coxeter_system->get_degree(s); k++)
+		{
+			int i = coxeter_system->get_neighbor(s,k);
+			NUMBERS_DATATYPE old = word[i];
+			if (coxeter_system->ring_p == 0 && coxeter_system->ring_q == 0)
+			{
+				NUMBERS_DATATYPE product;
+				if (__builtin_mul_overflow((NUMBERS_DATATYPE) coxeter_system->get_amplitude(s,k), word[s], &product) || __builtin_add_overflow(word[i], product, &word[i]))
+				{ coxeter_system->report_overflow(); }
+			}
+			else { word[i] = coxeter_system->fire(word[i], s, k, word[s]); }
+			fingerprint += keys[i] * ((unsigned long long) word[i] - (unsigned long long) old);
+		}
+
+		if ( word[s] > 0 ) { length++;  if (heap_valid == 1) { update_heap_state(s, 1); } }
+		else { length--;  heap_valid = 0; }
+
+		fingerprint -= 2 * keys[s] * (unsigned long long) word[s];
+		word[s] = 0 - word[s];
+
+		// perform type-dependent multiplication on one_line (word-only types have none).
+		if (coxeter_system->track_one_line == 1) { coxeter_system->right_multiply(one_line, s); }
+	}
+
+	// WARNING:  left multiplication is not optimized.
+	void CoxeterElement::left_multiply(int s)
+	{
+		int* reduced = new int[ length ];
+		get_reduced_expression(reduced);
+
+		CoxeterElement t = CoxeterElement(coxeter_system);
+		int count_moves = 1;
+		t.right_multiply(s);
+		for (int i = 0; i < length; i++)
+		{
+			if (t.word[ reduced[i] ] > 0) { count_moves++; } else { count_moves--; }
+			t.right_multiply(reduced[i]);
+		}
+
+		for (int i = 0; i < size; i++)
+		{
+			word[i] = t.word[i];
+			one_line[i] = t.one_line[i];
+		}
+		one_line[size] = t.one_line[size];
+		length = count_moves;
+		fingerprint = t.fingerprint;
+
+		// t was built by right multiplications, so its heap state is valid if they all increased the length.
+		for (int i = 0; i < 3*size; i++) { heap_state[i] = t.heap_state[i]; }
+		heap_valid = t.heap_valid;
+
+		delete [] reduced;
+	}
+
+	// reverse the reduced expression and replay it from the identity.
+	void CoxeterElement::invert()
+	{
+		int* reduced = new int[ length ];
+		get_reduced_expression(reduced);
+
+		int len = length;
+		for (int i = 0; i < size; i++)
+		{
+			word[i] = 1;
+			one_line[i] = i+1;
+		}
+		one_line[size] = size+1;
+		length = 0;
+		fingerprint = coxeter_system->get_fingerprint(word);
+		clear_heap_state();
+
+		for (int i = len-1; i >= 0; i--)
+		{ right_multiply(reduced[i]); }
+
+		delete [] reduced;
+	}
+
+	// diagram automorphisms preserve the Coxeter matrix, so the image of a reduced expression is reduced.
+	void CoxeterElement::apply_automorphism(int a)
+	{
+		int* reduced = new int[ length ];
+		get_reduced_expression(reduced);
+
+		int len = length;
+		for (int i = 0; i < size; i++)
+		{
+			word[i] = 1;
+			one_line[i] = i+1;
+		}
+		one_line[size] = size+1;
+		length = 0;
+		fingerprint = coxeter_system->get_fingerprint(word);
+		clear_heap_state();
+
+		for (int i = 0; i < len; i++)
+		{ right_multiply(coxeter_system->get_automorphism(a, reduced[i])); }
+
+		delete [] reduced;
+	}
+
+	int CoxeterElement::get_length()
+	{
+		int count_moves = 0;
+		get_reduced_expression(NULL, count_moves);
+		return count_moves;
+	}
+
+	void CoxeterElement::get_reduced_expression(int reduced[])
+	{
+		int c = 0;
+		get_reduced_expression(reduced, c);
+	}
+
+	// requires an allocated array of length at least this->length.
+	void CoxeterElement::get_reduced_expression(int reduced[], int& count_moves)
+	{
+		count_moves = 0;
+
+		CoxeterElement t = *this;  // using copy-constructor, t is on the heap...
+		
+		while (1==1)
+		{
+			int move = 0;
+			for (move = 0; move < size; move++)
+			{
+				if (t.word[move] < 0) { break; }
+			}
+
+			if (move >= size) { break; }
+
+			if (reduced != NULL) { reduced[length-1-count_moves] = move; }
+			count_moves++;
+			t.right_multiply(move);
+		}
+	}
+
+	int CoxeterElement::get_rank(int reduced[])
+	{
+		vector<int> support;
+		
+		for (int i = 0; i < length; i++)
+		{
+			int contains = 0;
+			for (int j = 0; j < support.size(); j++)
+			{ 
+				if (support[j] == reduced[i]) { contains = 1; } 
+			}
+			if (contains == 0) { support.push_back( reduced[i] ); }
+		}
+
+		return support.size();
+	}
+
+	CoxeterElement::~CoxeterElement()
+	{
+		delete[] word;
+		delete[] one_line;
+		delete[] heap_state;
+	}
+
+	void CoxeterElement::print_heap()
+	{
+		int* reduced = new int[ length ];
+		get_reduced_expression(reduced);
+
+		int level[length];
+		for (int i = 0; i < length; i++) { level[i] = 0; }
+
+		int heap[size];
+		for (int i = 0; i < size; i++) { heap[i] = 0; }
+
+		cout << "length : " << length << endl;
+		for (int i = 0; i < length; i++) { cout << reduced[i] << " "; }
+		cout << endl;
+
+		for (int i = 0; i < length; i++)
+		{
+			for ( int m = 0 ; m < size; m++ )
+			{
+				if (this->coxeter_system->get_exponent(m, reduced[i]) >= 3) 
+				{ heap[m] = heap[reduced[i]]+1; }
+			}
+
+			level[ i ] = heap[reduced[i]];
+		}
+
+		cout << endl;
+
+		for (int le = length-1; le >= 0; le--)
+		{
+			for (int seek = 0 ; seek < size; seek++)
+			{
+				int found = 0;
+				for (int i = 0; i < length; i++)
+				{
+				if (level[i] == le && reduced[i] == seek) { cout <<  "* ";  found = 1; }
+				}
+
+				if (found == 0) { cout << "  "; }
+	 		}
+			cout << endl;
+		}
+
+		// add coalescing code?  For each entry, l->r if there is nothing immediately above (but there is eventually), then move the elt up.
+
+		cout << endl;
+	}
+
+
+	// This checks type A, B, D-style one_line pattern containment:  i.e. the bars must be in the same position, and the digits flatten.
+	// Currently only used/extensively tested with type D.  There is a size difference in the one_line array for type A.
+	// To check w against a whole list of patterns (of different sizes) in one pass, use a PatternSet.
+	int CoxeterElement::contains_one_line_pattern(CoxeterElement& pattern)
+	{
+		// look at all subwords of size pattern->size in this.
+		// see if they flatten to the first pattern->size entries of pattern, with the same bar pattern.
+		int any_match = 0;
+		
+		int k = pattern.size;
+
+		// the k-subsets of the positions, in colex order.
+		Bitset positions(this->size);
+		positions.first_combination(k);
+		int* sub_one_line = new int[ k ];
+		int* flattened = new int[k];
+
+		int more = (k <= this->size) ? 1 : 0;
+		while (more == 1)
+		{
+			// map to indicies to get subword.
+			int iii=0;
+			for (int ii = 0; ii < this->size; ii++) { if ( positions.get(ii) == 1 ) { sub_one_line[iii] = ii; iii++; } }
+
+			// flatten and test.
+			for (int i = 0; i < k; i++) { flattened[i] = 0; }
+			int next_digit = 1;
+			for (int search_for = 1; search_for <= this->size; search_for++)
+			{
+			  for (int i = 0; i < k; i++)
+			  {
+				  if (abs(this->one_line[ sub_one_line[i] ]) == search_for)
+				  {
+					  flattened[i] = next_digit;
+					  if (this->one_line[ sub_one_line[i] ] < 0) { flattened[i] = 0 - flattened[i]; }
+					  next_digit++;
+				  }
+			  }
+			}
+
+			int matches = 1;
+			for (int i = 0; i < k; i++)
+			{
+				if (flattened[i] != pattern.one_line[i]) { matches = 0; }
+			}
+
+			// test output.
+			if (matches == 1) { any_match = 1;  if (DEBUG_VERBOSE) { cout << " (one_line pattern match on "; pattern.print(); cout << ") " << endl; }  break; }
+			 
+			if (DEBUG_VERBOSE)
+			{	
+			  string b;
+			  positions.sprint(b);
+			  cout << "n = " << this->size << " k = " << k << ": " << b;
+			  cout << " : ";
+			  for (int i = 0; i < k; i++) { cout << sub_one_line[i]; }
+			  cout << " : ";
+			  for (int i = 0; i < k; i++) { cout << flattened[i]; }
+			  cout << "  Match on "; pattern.print(); cout << " : " << matches << endl;
+			}
+
+			more = positions.next_combination();
+		}
+
+		delete[] sub_one_line;
+		delete[] flattened;
+		return any_match;
+	}
+
+
+//////////////////////////////////////////////////////////////////////
+//
+//  End of eriksson library code.
+//
+//////////////////////////////////////////////////////////////////////
+
+
@@ -1,52 +1,75 @@
-#include "CoxeterSystem.h"
-
-
-//////////////////////////////////////////////////////////////////////
-//
-// This is an implementation of the numbers game by Kimmo Eriksson, 
-// as described by Bjorner/Brenti in Combinatorics of Coxeter Groups.
-//
-//////////////////////////////////////////////////////////////////////
-
-
-class CoxeterElement
-{
-	public:
-		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
-		int size;  // number of generators in the coxeter matrix from coxeter_system->size.
-
-		int* word;  // this is generalized 1-line notation from numbers game...
-		int* one_line;  // this is the usual 1-line notation (only guarenteed to make sense in types A and D)...
-		int length; // WARNING:  users should not update word or one_line directly, without adjusting length.
-
-		CoxeterElement::CoxeterElement(CoxeterSystem* cs);  // construct identity element.
-		CoxeterElement::CoxeterElement(CoxeterSystem* cs, int w[], int ol[]);  // construct element with given word and 1-line notation.
-		CoxeterElement::CoxeterElement(CoxeterSystem* cs, int red[], int len);  // construct element with given reduced word.
-		CoxeterElement::CoxeterElement(const CoxeterElement& cp);   // copy-constructor: for passing by reference in functions and creating copies on the heap.
-		//CoxeterElement::operator=(const CoxeterElement& cp);   // = operator copy-constructor: for passing by reference in functions and creating copies on the heap.
-		CoxeterElement::~CoxeterElement();
-
-		int CoxeterElement::equals(CoxeterElement* cp);
-
-		void CoxeterElement::print();
-		void CoxeterElement::print_reduced_expression();
-		void CoxeterElement::sprint_reduced_expression(string& s);
-
-		void CoxeterElement::right_multiply(int s);
-		void CoxeterElement::left_multiply(int s);  // WARNING:  this is not speed-optimized...
-
-		int CoxeterElement::has_right_ascent(int s);
-		int CoxeterElement::has_right_descent(int s);
-
-		int CoxeterElement::get_length();
-		void CoxeterElement::get_reduced_expression(int reduced[]);  // requires an allocated int array of length at least this->length.
-		void CoxeterElement::get_reduced_expression(int reduced[], int& count_moves);
-		int CoxeterElement::get_rank(int reduced[]);
-
-		int CoxeterElement::contains_one_line_pattern(CoxeterElement& pattern);
-
-		void CoxeterElement::print_heap();
-
-};
-
-
+#ifndef COXETERELEMENT_H
+#define COXETERELEMENT_H
+
+#include "CoxeterSystem.h"
+
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is an implementation of the numbers game by Kimmo Eriksson, 
+// as described by Bjorner/Brenti in Combinatorics of Coxeter Groups.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class CoxeterElement
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		int size;  // number of generators in the coxeter matrix from coxeter_system->size.
+
+		NUMBERS_DATATYPE* word;  // this is generalized 1-line notation from numbers game...
+		int* one_line;  // this is the usual 1-line notation (only kept up to date in types A, B and D:  see CoxeterSystem::track_one_line)...
+		int length; // WARNING:  users should not update word or one_line directly, without adjusting length.
+		unsigned long long fingerprint;  // coxeter_system->get_fingerprint(word), kept up to date by the multiplications (so likewise).
+
+		// heap state, for O(1) short-braid-avoidance tests.  For each generator s:
+		//   heap_state[s]          = number of generators not commuting with s after the last occurrence of s,
+		//   heap_state[size+s]     = number of generators not commuting with s before the first occurrence of s,
+		//   heap_state[2*size+s]   = number of occurrences of s,
+		// all saturated at 2, with -1 in the first two when s does not occur.  These only depend on the element when it is
+		// short-braid-avoiding.  The state is maintained by length-increasing multiplications, and rebuilt from the reduced
+		// expression after anything else (heap_valid == 0).
+		int* heap_state;
+		int heap_valid;
+
+		CoxeterElement::CoxeterElement(CoxeterSystem* cs);  // construct identity element.
+		CoxeterElement::CoxeterElement(CoxeterSystem* cs, NUMBERS_DATATYPE w[], int ol[]);  // construct element with given word and 1-line notation.
+		CoxeterElement::CoxeterElement(CoxeterSystem* cs, int red[], int len);  // construct element with given reduced word.
+		CoxeterElement::CoxeterElement(const CoxeterElement& cp);   // copy-constructor: for passing by reference in functions and creating copies on the heap.
+		//CoxeterElement::operator=(const CoxeterElement& cp);   // = operator copy-constructor: for passing by reference in functions and creating copies on the heap.
+		CoxeterElement::~CoxeterElement();
+
+		int CoxeterElement::equals(CoxeterElement* cp);  // compares the fingerprints first, and the words only if they agree.
+		int CoxeterElement::bruhat_leq(CoxeterElement& w);  // 1 if this element is below w in the Bruhat order.
+
+		void CoxeterElement::print();
+		void CoxeterElement::print_reduced_expression();
+		void CoxeterElement::sprint_reduced_expression(string& s);
+
+		void CoxeterElement::right_multiply(int s);
+		void CoxeterElement::left_multiply(int s);  // WARNING:  this is not speed-optimized...
+		void CoxeterElement::invert();  // replaces this element by its inverse.
+		void CoxeterElement::apply_automorphism(int a);  // replaces each generator s by coxeter_system->get_automorphism(a, s).
+
+		int CoxeterElement::has_right_ascent(int s);
+		int CoxeterElement::has_right_descent(int s);
+
+		int CoxeterElement::right_extension_avoids_short_braid(int s);  // assuming this is short-braid-avoiding, is this*s?
+		int CoxeterElement::left_extension_avoids_short_braid(int s);  // assuming this is short-braid-avoiding, is s*this?
+		void CoxeterElement::clear_heap_state();
+		void CoxeterElement::update_heap_state(int s, int on_right);  // records a length-increasing multiplication by s.
+		void CoxeterElement::build_heap_state();
+
+		int CoxeterElement::get_length();
+		void CoxeterElement::get_reduced_expression(int reduced[]);  // requires an allocated int array of length at least this->length.
+		void CoxeterElement::get_reduced_expression(int reduced[], int& count_moves);
+		int CoxeterElement::get_rank(int reduced[]);
+
+		int CoxeterElement::contains_one_line_pattern(CoxeterElement& pattern);
+
+		void CoxeterElement::print_heap();
+
+};
+
+#endif
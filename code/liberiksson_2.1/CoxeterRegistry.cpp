@@ -0,0 +1,190 @@
+#include "CoxeterRegistry.h"
+
+#include <fstream>
+
+
+	CoxeterRegistry::CoxeterRegistry()
+	{
+	}
+
+	CoxeterRegistry::~CoxeterRegistry()
+	{
+		for (map<string, CoxeterSystem*>::iterator iter = systems.begin(); iter != systems.end(); iter++)
+		{ delete (*iter).second; }
+	}
+
+	CoxeterSystem* CoxeterRegistry::get(string name)
+	{
+		map<string, CoxeterSystem*>::iterator iter = systems.find(name);
+		if (iter != systems.end()) { return (*iter).second; }
+
+		// an I2(m) name is never read as a file, so an unsupported m is reported once, by build().
+		CoxeterSystem* cs = build(name);
+		if (cs == NULL && name.substr(0, 3) != "I2(") { cs = load(name); }
+		if (cs != NULL) { systems[name] = cs; }
+		return cs;
+	}
+
+	string CoxeterRegistry::get_name(CoxeterSystem* cs)
+	{
+		for (map<string, CoxeterSystem*>::iterator iter = systems.begin(); iter != systems.end(); iter++)
+		{ if ((*iter).second == cs) { return (*iter).first; } }
+		return "";
+	}
+
+	// m[n*s + t] for the Coxeter graph, with m = 2 off the edges.
+	static void join(vector<int>& m, int n, int s, int t, int e)
+	{
+		m[(n * s) + t] = e;
+		m[(n * t) + s] = e;
+	}
+
+	CoxeterSystem* CoxeterRegistry::build(string name)
+	{
+		if (name.size() < 2) { return NULL; }
+
+		char family = name[0];
+		int affine = (name[1] == '~') ? 1 : 0;
+
+		// I2(m) is the only name with a parameter other than the rank.
+		if (family == 'I' && name.size() > 4 && name.substr(0, 3) == "I2(" && name[name.size()-1] == ')')
+		{
+			// the numbers game is exact in Z (m = 3, 4, 6) and in Z[r] for one r, so the other m are not available.
+			int e = atoi(name.substr(3, name.size()-4).c_str());
+			if (e != 3 && e != 4 && e != 5 && e != 6 && e != 8 && e != 10 && e != 12)
+			{ cout << "ERROR:  " << name << " is not supported (only m = 3, 4, 5, 6, 8, 10 and 12 are)." << endl;  return NULL; }
+			vector<int> m(4, 2);
+			m[0] = 0;  m[3] = 0;
+			join(m, 2, 0, 1, e);
+			int swap[] = { 1, 0 };
+			return new CoxeterSystem(2, &m[0], 1, swap);
+		}
+
+		string digits = name.substr(1 + affine);
+		if (digits.size() == 0 || digits.find_first_not_of("0123456789") != string::npos) { return NULL; }
+		int rank = atoi(digits.c_str());
+
+		// the affine type X~r has r+1 generators.
+		int n = rank + affine;
+		if (rank < 1 || n > 63) { return NULL; }
+
+		vector<int> m(n * n, 2);
+		for (int s = 0; s < n; s++) { m[(n * s) + s] = 0; }
+		vector<int> automorphism;
+
+		if (affine == 1)
+		{
+			if (family == 'A')
+			{
+				if (rank == 1) { join(m, n, 0, 1, -1); }
+				else { for (int s = 0; s < n; s++) { join(m, n, s, (s+1) % n, 3); } }
+			}
+			else if (family == 'C' && rank >= 2)
+			{
+				for (int s = 0; s+1 < n; s++) { join(m, n, s, s+1, 3); }
+				join(m, n, 0, 1, 4);
+				join(m, n, n-2, n-1, 4);
+			}
+			else if (family == 'D' && rank >= 4)
+			{
+				join(m, n, 0, 2, 3);
+				for (int s = 1; s+2 < n; s++) { join(m, n, s, s+1, 3); }
+				join(m, n, n-3, n-1, 3);
+			}
+			else { return NULL; }
+			return new CoxeterSystem(n, &m[0], 0, NULL);
+		}
+
+		if (family == 'A')
+		{
+			for (int s = 0; s+1 < n; s++) { join(m, n, s, s+1, 3); }
+			for (int s = 0; s < n; s++) { automorphism.push_back(n-1-s); }
+			return new TypeACoxeterSystem(n, &m[0], 1, &automorphism[0]);
+		}
+		if (family == 'B' && n >= 2)
+		{
+			for (int s = 0; s+1 < n; s++) { join(m, n, s, s+1, 3); }
+			join(m, n, 0, 1, 4);
+			return new TypeBCoxeterSystem(n, &m[0], 0, NULL);
+		}
+		if (family == 'D' && n >= 3)
+		{
+			join(m, n, 0, 2, 3);
+			for (int s = 1; s+1 < n; s++) { join(m, n, s, s+1, 3); }
+			automorphism.push_back(1);
+			automorphism.push_back(0);
+			for (int s = 2; s < n; s++) { automorphism.push_back(s); }
+			return new TypeDCoxeterSystem(n, &m[0], 1, &automorphism[0]);
+		}
+		if (family == 'E' && n >= 6)
+		{
+			// the long arm is 0--1--2--3--4(--6--7--...), and 5 hangs off 2.  From E9 on the group is infinite.
+			for (int s = 0; s < 4; s++) { join(m, n, s, s+1, 3); }
+			join(m, n, 2, 5, 3);
+			if (n >= 7) { join(m, n, 4, 6, 3); }
+			for (int s = 6; s+1 < n; s++) { join(m, n, s, s+1, 3); }
+			if (n == 6)
+			{
+				int e6[] = { 4, 3, 2, 1, 0, 5 };
+				return new CoxeterSystem(n, &m[0], 1, e6);
+			}
+			return new CoxeterSystem(n, &m[0], 0, NULL);
+		}
+		if (family == 'F' && n == 4)
+		{
+			join(m, n, 0, 1, 3);
+			join(m, n, 1, 2, 4);
+			join(m, n, 2, 3, 3);
+			return new CoxeterSystem(n, &m[0], 0, NULL);
+		}
+		if (family == 'G' && n == 2)
+		{
+			join(m, n, 0, 1, 6);
+			return new CoxeterSystem(n, &m[0], 0, NULL);
+		}
+		if (family == 'H' && (n == 3 || n == 4))
+		{
+			join(m, n, 0, 1, 5);
+			for (int s = 1; s+1 < n; s++) { join(m, n, s, s+1, 3); }
+			return new CoxeterSystem(n, &m[0], 0, NULL);
+		}
+		return NULL;
+	}
+
+	CoxeterSystem* CoxeterRegistry::load(string filename)
+	{
+		ifstream in(filename.c_str());
+		if (!in) { return NULL; }
+
+		int n = 0;
+		in >> n;
+		if (n < 1 || n > 63) { cout << "ERROR:  " << filename << " does not start with a rank from 1 to 63." << endl;  return NULL; }
+
+		vector<int> m(n * n, 0);
+		for (int i = 0; i < n*n; i++)
+		{
+			if (!(in >> m[i])) { cout << "ERROR:  " << filename << " does not hold a " << n << " x " << n << " Coxeter matrix." << endl;  return NULL; }
+		}
+		// the numbers game only knows these entries, and the ones with a square root must all share one ring Z[r].
+		int ring = 0;  // 5 for the golden ratio, 8 for sqrt 2, 12 for sqrt 3.
+		for (int s = 0; s < n; s++)
+		{
+			for (int t = 0; t < n; t++)
+			{
+				int e = m[(n * s) + t];
+				if (e != m[(n * t) + s] || (s == t && e != 0))
+				{ cout << "ERROR:  " << filename << " is not a symmetric Coxeter matrix." << endl;  return NULL; }
+				if (s == t) { continue; }
+
+				if (e != 2 && e != 3 && e != 4 && e != 5 && e != 6 && e != 8 && e != 10 && e != 12 && e != -1)
+				{ cout << "ERROR:  " << filename << " has the entry " << e << " (only 2, 3, 4, 5, 6, 8, 10, 12 and -1 are supported)." << endl;  return NULL; }
+
+				int r = (e == 10) ? 5 : e;
+				if (r != 5 && r != 8 && r != 12) { continue; }
+				if (ring != 0 && ring != r)
+				{ cout << "ERROR:  " << filename << " mixes entries that need different quadratic rings (" << ring << " and " << e << ")." << endl;  return NULL; }
+				ring = r;
+			}
+		}
+		return new CoxeterSystem(n, &m[0], 0, NULL);
+	}
@@ -0,0 +1,45 @@
+#ifndef COXETERREGISTRY_H
+#define COXETERREGISTRY_H
+
+#include "CoxeterSystem.h"
+
+
+//////////////////////////////////////////////////////////////////////
+//
+// This builds Coxeter systems on demand, by name, instead of using the
+// static systems in CoxeterSystem.h (which every file including the
+// header constructs at startup, and which stop at A12 and D10).
+//
+// The names are the Cartan types A1.., B2.., D3.., E6.., F4, G2, H3,
+// H4, I2(m) for m = 3, 4, 5, 6, 8, 10, 12 (other m print an error),
+// and the affine types A~1.., C~2.., D~4.., with the same generator
+// numbering as the static systems (En for n > 8 extends the long arm
+// of E8, and is infinite).  Every family goes up to 63 generators.
+// ElementIndex only ranks the groups whose orders fit in a long long
+// (up to A19, B16 and D16).  Any other name is read as a file holding
+// the rank n followed by the n x n Coxeter matrix (0 on the diagonal,
+// -1 for infinity).
+//
+// Each system is built once, and kept (with the tables it builds as
+// it is used, like the numbers game amplitudes and the Bruhat memo)
+// until the registry is destroyed.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class CoxeterRegistry
+{
+	public:
+		map<string, CoxeterSystem*> systems;  // the systems are allocated in this class.
+
+		CoxeterRegistry::CoxeterRegistry();
+		CoxeterRegistry::~CoxeterRegistry();
+
+		CoxeterSystem* CoxeterRegistry::get(string name);  // NULL if the name is neither a type nor a readable matrix file.
+		string CoxeterRegistry::get_name(CoxeterSystem* cs);  // the name cs was built under, or "".
+
+		CoxeterSystem* CoxeterRegistry::build(string name);
+		CoxeterSystem* CoxeterRegistry::load(string filename);
+};
+
+#endif
@@ -1,109 +1,789 @@
-#include "CoxeterSystem.h"
-
-
-CoxeterSystem::CoxeterSystem(const CoxeterSystem& cs)
-{
-	size = cs.size;
-	coxeter_matrix = new int[size * size];
-	for (int i = 0; i < size*size; i++)
-	{
-		coxeter_matrix[i] = cs.coxeter_matrix[i];
-	}
-
-	automorphism_group_size = cs.automorphism_group_size;
-	automorphism_group = new int[automorphism_group_size * size];
-	for (int i = 0; i < automorphism_group_size*size; i++)
-	{
-		automorphism_group[i] = cs.automorphism_group[i];
-	}
-}
-
-CoxeterSystem::CoxeterSystem(int n, int cm[], int ags, int ag[])
-{
-	size = n;
-	coxeter_matrix = new int[size * size];
-	for (int i = 0; i < size*size; i++)
-	{
-		coxeter_matrix[i] = cm[i];
-	}
-
-	automorphism_group_size = ags;
-	automorphism_group = new int[automorphism_group_size * size];
-	for (int i = 0; i < ags*size; i++)
-	{
-		automorphism_group[i] = ag[i];
-	}
-}
-
-int CoxeterSystem::equals(CoxeterSystem* cs)
-{
-		if (cs->size != this->size) { return 0; }
-		int ret = 1;
-		for (int i = 0; i < size*size; i++)
-		{
-			if (cs->coxeter_matrix[i] != this->coxeter_matrix[i]) { ret = 0; }
-		}
-		return ret;
-}
-
-
-void CoxeterSystem::print_matrix()
-{
-		for (int i = 0; i < size; i++)
-		{ 
-			for (int j = 0; j < size; j++)
-			{
-				cout << get_exponent(i,j) << " ";
-			}
-			cout << endl;
-		}
-}
-
-int CoxeterSystem::get_exponent(int x, int y)
-{
-	return coxeter_matrix[ (size * x) + y ];
-}
-
-int CoxeterSystem::get_automorphism(int i, int j)
-{
-	return automorphism_group[ (size * i) + j ];
-}
-
-int CoxeterSystem::right_multiply(int one_line[], int i)
-{
-	int t = one_line[i];
-	one_line[i] = one_line[i+1];
-	one_line[i+1] = t;
-	return 0;
-}
-
-CoxeterSystem::~CoxeterSystem()
-{
-	delete[] coxeter_matrix;
-	delete[] automorphism_group;
-}
-
-
-/////////////////////////////////////////////////////////////////////
-
-int TypeDCoxeterSystem::right_multiply(int one_line[], int i)
-{
-	if (i > 0)
-	{
-	int t = one_line[i-1];
-	one_line[i-1] = one_line[i];
-	one_line[i] = t;
-	}
-	else if (i == 0)
-	{
-	int t = one_line[i];
-	one_line[i] = one_line[i+1];
-	one_line[i+1] = t;
-	one_line[i] = 0 - one_line[i];
-	one_line[i+1] = 0 - one_line[i+1];
-	}
-
-	return 0;
-}
-
-
+#include "CoxeterSystem.h"
+
+#include <limits.h>
+
+
+CoxeterSystem::CoxeterSystem(const CoxeterSystem& cs)
+{
+	size = cs.size;
+	coxeter_matrix = new int[size * size];
+	for (int i = 0; i < size*size; i++)
+	{
+		coxeter_matrix[i] = cs.coxeter_matrix[i];
+	}
+
+	automorphism_group_size = cs.automorphism_group_size;
+	automorphism_group = new int[automorphism_group_size * size];
+	for (int i = 0; i < automorphism_group_size*size; i++)
+	{
+		automorphism_group[i] = cs.automorphism_group[i];
+	}
+
+	build_neighbors();
+	track_one_line = cs.track_one_line;
+
+	bruhat_x = new NUMBERS_DATATYPE[size];
+	bruhat_w = new NUMBERS_DATATYPE[size];
+	bruhat_cache = NULL;
+}
+
+CoxeterSystem::CoxeterSystem(int n, int cm[], int ags, int ag[])
+{
+	size = n;
+	coxeter_matrix = new int[size * size];
+	for (int i = 0; i < size*size; i++)
+	{
+		coxeter_matrix[i] = cm[i];
+	}
+
+	automorphism_group_size = ags;
+	automorphism_group = new int[automorphism_group_size * size];
+	for (int i = 0; i < ags*size; i++)
+	{
+		automorphism_group[i] = ag[i];
+	}
+
+	build_neighbors();
+	track_one_line = 0;
+
+	bruhat_x = new NUMBERS_DATATYPE[size];
+	bruhat_w = new NUMBERS_DATATYPE[size];
+	bruhat_cache = NULL;
+}
+
+// precompute the Coxeter graph adjacency, so heap updates only visit the generators that do not commute.
+//
+// Also precompute the numbers game amplitudes:  firing s adds amplitude(s,t) * word[s] to word[t].  
+// The product amplitude(s,t) * amplitude(t,s) must be 4cos^2(pi/m), so for m = 4, 6 the two 
+// directions of an edge get different amplitudes (we put the larger one on the edge from the 
+// smaller generator).  With equal amplitudes 2, 2 the game would describe an infinite group.
+//
+// For m = 5 the amplitudes are both the golden ratio r (r^2 = r + 1), and for m = 8, 10, 12 they
+// are 2 + r and 1, where r is sqrt 2, the golden ratio, and sqrt 3 respectively.
+void CoxeterSystem::build_neighbors()
+{
+	ring_p = 0;
+	ring_q = 0;
+	for (int i = 0; i < size*size; i++)
+	{
+		int m = coxeter_matrix[i];
+		int p = 0;
+		int q = 0;
+		if (m == 5 || m == 10) { p = 1;  q = 1; }
+		else if (m == 8) { q = 2; }
+		else if (m == 12) { q = 3; }
+		else { continue; }
+
+		if ((ring_p != 0 || ring_q != 0) && (ring_p != p || ring_q != q))
+		{ cout << "ERROR:  coxeter matrix entries " << m << " need different quadratic rings." << endl;  continue; }
+		ring_p = p;
+		ring_q = q;
+	}
+
+	overflow_count = 0;
+	degree = new int[size];
+	neighbors = new int[size * size];
+	amplitudes = new int[size * size];
+	amplitude_pairs = new long long[2 * size * size];
+	for (int s = 0; s < size; s++)
+	{
+		degree[s] = 0;
+		for (int t = 0; t < size; t++)
+		{
+			int m = get_exponent(s,t);
+			if (m >= 3 || m == -1)
+			{
+				int a = 0;
+				int b = 0;  // the coefficient of r.
+				if (m == 3) { a = 1; }
+				else if (m == 4) { if (s < t) { a = 2; } else { a = 1; } }
+				else if (m == 6) { if (s < t) { a = 3; } else { a = 1; } }
+				else if (m == -1) { a = 2; }  // meaning infinity
+				else if (m == 5) { b = 1; }
+				else if (m == 8 || m == 10 || m == 12) { if (s < t) { a = 2;  b = 1; } else { a = 1; } }
+				else { cout << "ERROR:  coxeter matrix entry " << m << " not supported." << endl; } 
+
+				neighbors[ (size * s) + degree[s] ] = t;
+				amplitudes[ (size * s) + degree[s] ] = a;
+				amplitude_pairs[ 2*((size * s) + degree[s]) ] = a;
+				amplitude_pairs[ 2*((size * s) + degree[s]) + 1 ] = b;
+				degree[s]++;
+			}
+		}
+	}
+
+	// odd keys from the splitmix64 sequence.
+	fingerprint_keys = new unsigned long long[size];
+	for (int i = 0; i < size; i++)
+	{
+		unsigned long long z = 0x9E3779B97F4A7C15ULL * (unsigned long long) (i+1);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		fingerprint_keys[i] = (z ^ (z >> 31)) | 1ULL;
+	}
+
+	// the starting entries of the numbers game are 1, so 1 is number 0.
+	numbers.clear();
+	number_slots.clear();
+	if (is_quadratic()) { number_slots.assign(1024, 0);  make_number(1, 0); }
+}
+
+// Sylvester's criterion on the matrix B(s,t) = -cos(pi/m(s,t)), with B(s,t) = -1 for m = infinity.
+int CoxeterSystem::is_finite()
+{
+	vector<double> b(size * size);
+	for (int s = 0; s < size; s++)
+	{
+		for (int t = 0; t < size; t++)
+		{
+			int m = coxeter_matrix[(size * s) + t];
+			if (s == t) { b[(size * s) + t] = 1.0; }
+			else if (m == -1) { b[(size * s) + t] = -1.0; }
+			else { b[(size * s) + t] = -cos(M_PI / (double) m); }
+		}
+	}
+
+	// Gaussian elimination:  the pivots are the ratios of consecutive leading principal minors.
+	for (int k = 0; k < size; k++)
+	{
+		if (b[(size * k) + k] < 1e-9) { return 0; }
+		for (int i = k+1; i < size; i++)
+		{
+			double f = b[(size * i) + k] / b[(size * k) + k];
+			for (int j = k; j < size; j++) { b[(size * i) + j] -= f * b[(size * k) + j]; }
+		}
+	}
+	return 1;
+}
+
+void CoxeterSystem::report_overflow()
+{
+	if (overflow_count == 0) { cout << "ERROR:  numbers game entry overflow (rebuild with a wider NUMBERS_DATATYPE)." << endl; }
+	overflow_count++;
+}
+
+int CoxeterSystem::is_quadratic()
+{
+	return (ring_p != 0 || ring_q != 0);
+}
+
+// the sign of a + b r, where 2r = ring_p + sqrt(D) with D = ring_p^2 + 4 ring_q, so 2(a + b r) = X + b sqrt(D).
+int CoxeterSystem::number_sign(long long a, long long b)
+{
+	__int128 x = (2 * (__int128) a) + ((__int128) b * ring_p);
+	__int128 d = ((__int128) ring_p * ring_p) + (4 * (__int128) ring_q);
+	int sx = (x > 0) - (x < 0);
+	int sb = (b > 0) - (b < 0);
+	if (sb == 0 || sx == sb) { return (sx != 0) ? sx : sb; }
+	if (sx == 0) { return sb; }
+	return (x * x > d * (__int128) b * (__int128) b) ? sx : sb;
+}
+
+int CoxeterSystem::make_number(long long a, long long b)
+{
+	int sign = number_sign(a, b);
+	if (sign == 0) { return 0; }
+	if (sign < 0) { a = -a;  b = -b; }
+
+	unsigned long long h = ((unsigned long long) a * 0x9E3779B97F4A7C15ULL) ^ ((unsigned long long) b * 0xC2B2AE3D27D4EB4FULL);
+	int capacity = number_slots.size();
+	int slot = (int) ((h ^ (h >> 31)) & (capacity - 1));
+	while (number_slots[slot] != 0)
+	{
+		int i = number_slots[slot] - 1;
+		if (numbers[2*i] == a && numbers[(2*i) + 1] == b) { return sign * (i + 1); }
+		slot = (slot + 1) & (capacity - 1);
+	}
+
+	int i = numbers.size() / 2;
+	numbers.push_back(a);
+	numbers.push_back(b);
+	number_slots[slot] = i + 1;
+
+	if (4 * (i + 1) > capacity)
+	{
+		number_slots.assign(2 * capacity, 0);
+		for (int j = 0; j <= i; j++)
+		{
+			h = ((unsigned long long) numbers[2*j] * 0x9E3779B97F4A7C15ULL) ^ ((unsigned long long) numbers[(2*j) + 1] * 0xC2B2AE3D27D4EB4FULL);
+			slot = (int) ((h ^ (h >> 31)) & ((2 * capacity) - 1));
+			while (number_slots[slot] != 0) { slot = (slot + 1) & ((2 * capacity) - 1); }
+			number_slots[slot] = j + 1;
+		}
+	}
+	return sign * (i + 1);
+}
+
+NUMBERS_DATATYPE CoxeterSystem::fire(NUMBERS_DATATYPE target, int s, int k, NUMBERS_DATATYPE source)
+{
+	if (!is_quadratic())
+	{
+		NUMBERS_DATATYPE product;
+		if (__builtin_mul_overflow((NUMBERS_DATATYPE) amplitudes[(size * s) + k], source, &product) || __builtin_add_overflow(target, product, &target))
+		{ report_overflow(); }
+		return target;
+	}
+	if (source == 0) { return target; }
+
+	long long ta = 0;
+	long long tb = 0;
+	if (target != 0)
+	{
+		int i = (target > 0) ? target - 1 : -target - 1;
+		ta = (target > 0) ? numbers[2*i] : -numbers[2*i];
+		tb = (target > 0) ? numbers[(2*i) + 1] : -numbers[(2*i) + 1];
+	}
+	int j = (int) ((source > 0) ? source - 1 : -source - 1);
+	long long sa = (source > 0) ? numbers[2*j] : -numbers[2*j];
+	long long sb = (source > 0) ? numbers[(2*j) + 1] : -numbers[(2*j) + 1];
+
+	// (alpha + beta r)(sa + sb r) = alpha sa + beta sb ring_q + (alpha sb + beta sa + beta sb ring_p) r.
+	long long alpha = amplitude_pairs[ 2*((size * s) + k) ];
+	long long beta = amplitude_pairs[ 2*((size * s) + k) + 1 ];
+	return make_number(ta + (alpha * sa) + (beta * sb * ring_q), tb + (alpha * sb) + (beta * sa) + (beta * sb * ring_p));
+}
+
+void CoxeterSystem::sprint_number(NUMBERS_DATATYPE x, string& s)
+{
+	stringstream str;
+	if (!is_quadratic() || x == 0)
+	{
+		// digit by digit, since there is no stream output for __int128.
+		string digits;
+		NUMBERS_DATATYPE y = x;
+		do { int d = (int) (y % 10);  digits.insert(digits.begin(), (char) ('0' + ((d < 0) ? -d : d)));  y = y / 10; } while (y != 0);
+		if (x < 0) { str << "-"; }
+		str << digits;
+	}
+	else
+	{
+		int i = (int) ((x > 0) ? x - 1 : -x - 1);
+		long long a = (x > 0) ? numbers[2*i] : -numbers[2*i];
+		long long b = (x > 0) ? numbers[(2*i) + 1] : -numbers[(2*i) + 1];
+		if (b == 0) { str << a; }
+		else
+		{
+			if (a != 0) { str << a << ((b > 0) ? "+" : ""); }
+			str << b << ((ring_p == 1) ? "f" : ((ring_q == 2) ? "r2" : "r3"));
+		}
+	}
+	s = str.str();
+}
+
+int CoxeterSystem::equals(CoxeterSystem* cs)
+{
+		if (cs->size != this->size) { return 0; }
+		int ret = 1;
+		for (int i = 0; i < size*size; i++)
+		{
+			if (cs->coxeter_matrix[i] != this->coxeter_matrix[i]) { ret = 0; }
+		}
+		return ret;
+}
+
+
+void CoxeterSystem::print_matrix()
+{
+		for (int i = 0; i < size; i++)
+		{ 
+			for (int j = 0; j < size; j++)
+			{
+				cout << get_exponent(i,j) << " ";
+			}
+			cout << endl;
+		}
+}
+
+int CoxeterSystem::get_exponent(int x, int y)
+{
+	return coxeter_matrix[ (size * x) + y ];
+}
+
+int CoxeterSystem::get_automorphism(int i, int j)
+{
+	return automorphism_group[ (size * i) + j ];
+}
+
+int CoxeterSystem::get_degree(int s)
+{
+	return degree[s];
+}
+
+int CoxeterSystem::get_neighbor(int s, int k)
+{
+	return neighbors[ (size * s) + k ];
+}
+
+int CoxeterSystem::get_amplitude(int s, int k)
+{
+	return amplitudes[ (size * s) + k ];
+}
+
+int CoxeterSystem::right_multiply(int one_line[], int i)
+{
+	int t = one_line[i];
+	one_line[i] = one_line[i+1];
+	one_line[i+1] = t;
+	return 0;
+}
+
+unsigned long long CoxeterSystem::get_fingerprint(NUMBERS_DATATYPE word[])
+{
+	unsigned long long f = 0;
+	for (int i = 0; i < size; i++) { f += fingerprint_keys[i] * (unsigned long long) word[i]; }
+	return f;
+}
+
+// Each character is a generator, unless the string has separators (anything other than a digit), in which case the
+// generators are the runs of digits between them:  so "1021", "1,0,2,1" and "( 1 0 2 1 )" are the same word, and
+// generators past 9 are written like "10,11,3".  word needs room for s.size() entries.
+int CoxeterSystem::parse_word(string s, int word[])
+{
+	int separated = (s.find_first_not_of("0123456789") != string::npos) ? 1 : 0;
+	int length = 0;
+	int i = 0;
+	while (i < s.size())
+	{
+		if (s[i] < '0' || s[i] > '9') { i++; continue; }
+
+		int g = 0;
+		do { g = (10 * g) + (s[i] - '0');  i++; } while (separated == 1 && i < s.size() && s[i] >= '0' && s[i] <= '9');
+
+		if (g >= size) { cout << "ERROR:  generator " << g << " in " << s << " is not one of 0, ..., " << (size-1) << "." << endl;  return -1; }
+		word[length] = g;
+		length++;
+	}
+	return length;
+}
+
+// one move of the numbers game on a word, without the one-line notation.  Returns the change in length.
+int CoxeterSystem::right_multiply_word(NUMBERS_DATATYPE word[], int s)
+{
+	if (is_quadratic())
+	{
+		for (int k = 0; k < degree[s]; k++)
+		{ word[ neighbors[(size * s) + k] ] = fire(word[ neighbors[(size * s) + k] ], s, k, word[s]); }
+	}
+	else
+	{
+		for (int k = 0; k < degree[s]; k++)
+		{
+			NUMBERS_DATATYPE product;
+			NUMBERS_DATATYPE& entry = word[ neighbors[(size * s) + k] ];
+			if (__builtin_mul_overflow((NUMBERS_DATATYPE) amplitudes[(size * s) + k], word[s], &product) || __builtin_add_overflow(entry, product, &entry))
+			{ report_overflow(); }
+		}
+	}
+
+	word[s] = 0 - word[s];
+	if (word[s] < 0) { return 1; }
+	return -1;
+}
+
+// Deodhar's property Z:  if s is a right descent of w, then x <= w iff min(x, xs) <= ws.  So each step removes
+// one letter from w, and there is no branching.  This plays the numbers game on copies of the two words.
+int CoxeterSystem::bruhat_leq_words(NUMBERS_DATATYPE x[], int x_length, NUMBERS_DATATYPE w[], int w_length)
+{
+	for (int i = 0; i < size; i++) { bruhat_x[i] = x[i];  bruhat_w[i] = w[i]; }
+
+	while (x_length < w_length)
+	{
+		if (x_length == 0) { return 1; }
+
+		int s = 0;
+		while (bruhat_w[s] > 0) { s++; }
+
+		if (bruhat_x[s] < 0) { x_length += right_multiply_word(bruhat_x, s); }
+		w_length += right_multiply_word(bruhat_w, s);
+	}
+
+	if (x_length > w_length) { return 0; }
+	for (int i = 0; i < size; i++) { if (bruhat_x[i] != bruhat_w[i]) { return 0; } }
+	return 1;
+}
+
+// the memo is direct-mapped on a hash of the two words, and stores the words to avoid false hits.
+int CoxeterSystem::lookup_bruhat(NUMBERS_DATATYPE x[], NUMBERS_DATATYPE w[])
+{
+	if (bruhat_cache == NULL) { return -1; }
+
+	unsigned long long h = 14695981039346656037ULL;
+	for (int i = 0; i < size; i++) { h = (h ^ (unsigned long long) x[i]) * 1099511628211ULL;  h = (h ^ (unsigned long long) w[i]) * 1099511628211ULL; }
+	NUMBERS_DATATYPE* slot = bruhat_cache + ((2*size+1) * (h % BRUHAT_CACHE_SLOTS));
+
+	if (slot[0] < 0) { return -1; }
+	for (int i = 0; i < size; i++)
+	{
+		if (slot[1+i] != x[i] || slot[1+size+i] != w[i]) { return -1; }
+	}
+	return (int) slot[0];
+}
+
+void CoxeterSystem::store_bruhat(NUMBERS_DATATYPE x[], NUMBERS_DATATYPE w[], int result)
+{
+	if (bruhat_cache == NULL)
+	{
+		bruhat_cache = new NUMBERS_DATATYPE[(2*size+1) * BRUHAT_CACHE_SLOTS];
+		for (int i = 0; i < BRUHAT_CACHE_SLOTS; i++) { bruhat_cache[(2*size+1) * i] = -1; }
+	}
+
+	unsigned long long h = 14695981039346656037ULL;
+	for (int i = 0; i < size; i++) { h = (h ^ (unsigned long long) x[i]) * 1099511628211ULL;  h = (h ^ (unsigned long long) w[i]) * 1099511628211ULL; }
+	NUMBERS_DATATYPE* slot = bruhat_cache + ((2*size+1) * (h % BRUHAT_CACHE_SLOTS));
+
+	slot[0] = result;
+	for (int i = 0; i < size; i++) { slot[1+i] = x[i];  slot[1+size+i] = w[i]; }
+}
+
+int CoxeterSystem::bruhat_leq_one_line(int x[], int w[])
+{
+	return -1;
+}
+
+long long CoxeterSystem::get_one_line_order()
+{
+	return 0;
+}
+
+long long CoxeterSystem::rank_one_line(int one_line[])
+{
+	return -1;
+}
+
+void CoxeterSystem::unrank_one_line(long long r, int one_line[])
+{
+	cout << "ERROR:  this Coxeter system has no one-line indexing." << endl;
+}
+
+int CoxeterSystem::has_one_line_descent(int one_line[], int i)
+{
+	return 0;
+}
+
+char CoxeterSystem::get_one_line_type()
+{
+	return 0;
+}
+
+CoxeterSystem::~CoxeterSystem()
+{
+	delete[] coxeter_matrix;
+	delete[] automorphism_group;
+	delete[] degree;
+	delete[] neighbors;
+	delete[] amplitudes;
+	delete[] amplitude_pairs;
+	delete[] fingerprint_keys;
+	delete[] bruhat_x;
+	delete[] bruhat_w;
+	if (bruhat_cache != NULL) { delete[] bruhat_cache; }
+}
+
+
+/////////////////////////////////////////////////////////////////////
+
+int TypeDCoxeterSystem::right_multiply(int one_line[], int i)
+{
+	if (i > 0)
+	{
+	int t = one_line[i-1];
+	one_line[i-1] = one_line[i];
+	one_line[i] = t;
+	}
+	else if (i == 0)
+	{
+	int t = one_line[i];
+	one_line[i] = one_line[i+1];
+	one_line[i+1] = t;
+	one_line[i] = 0 - one_line[i];
+	one_line[i+1] = 0 - one_line[i+1];
+	}
+
+	return 0;
+}
+
+// 0 from D17 on, where the order does not fit in a long long.
+long long TypeDCoxeterSystem::get_one_line_order()
+{
+	long long order = 1;
+	for (int i = 1; i <= size; i++) { if (order > LLONG_MAX / i) { return 0; }  order = order * i; }
+	for (int i = 1; i < size; i++) { if (order > LLONG_MAX / 2) { return 0; }  order = order * 2; }
+	return order;
+}
+
+long long TypeDCoxeterSystem::rank_one_line(int one_line[])
+{
+	long long r = 0;
+	for (int i = 0; i < size; i++)
+	{
+		int c = 0;
+		for (int j = i+1; j < size; j++) { if (abs(one_line[j]) < abs(one_line[i])) { c++; } }
+		r = (r * (size - i)) + c;
+	}
+
+	// the sign of the last entry is determined by the others.
+	for (int i = 0; i < size-1; i++)
+	{
+		r = 2*r;
+		if (one_line[i] < 0) { r++; }
+	}
+	return r;
+}
+
+void TypeDCoxeterSystem::unrank_one_line(long long r, int one_line[])
+{
+	int negatives = 0;
+	int* signs = new int[size];
+	for (int i = size-2; i >= 0; i--)
+	{
+		signs[i] = (int) (r % 2);
+		negatives += signs[i];
+		r = r / 2;
+	}
+	signs[size-1] = negatives % 2;
+
+	int* code = new int[size];
+	for (int i = size-1; i >= 0; i--)
+	{
+		code[i] = (int) (r % (size - i));
+		r = r / (size - i);
+	}
+
+	// the ith entry is the code[i]th smallest value not used yet.
+	int* used = new int[size+1];
+	for (int v = 1; v <= size; v++) { used[v] = 0; }
+	for (int i = 0; i < size; i++)
+	{
+		int c = code[i];
+		int v = 1;
+		while (used[v] == 1 || c > 0) { if (used[v] == 0) { c--; } v++; }
+		used[v] = 1;
+		if (signs[i] == 1) { one_line[i] = 0 - v; } else { one_line[i] = v; }
+	}
+	one_line[size] = size+1;
+
+	delete[] signs;
+	delete[] code;
+	delete[] used;
+}
+
+int TypeDCoxeterSystem::has_one_line_descent(int one_line[], int i)
+{
+	if (i == 0) { return (one_line[0] + one_line[1] < 0); }
+	return (one_line[i-1] > one_line[i]);
+}
+
+char TypeDCoxeterSystem::get_one_line_type()
+{
+	return 'D';
+}
+
+
+/////////////////////////////////////////////////////////////////////
+
+int TypeBCoxeterSystem::right_multiply(int one_line[], int i)
+{
+	if (i > 0)
+	{
+	int t = one_line[i-1];
+	one_line[i-1] = one_line[i];
+	one_line[i] = t;
+	}
+	else if (i == 0)
+	{
+	one_line[0] = 0 - one_line[0];
+	}
+
+	return 0;
+}
+
+// 0 from B17 on, where the order does not fit in a long long.
+long long TypeBCoxeterSystem::get_one_line_order()
+{
+	long long order = 1;
+	for (int i = 1; i <= size; i++) { if (order > LLONG_MAX / (2*i)) { return 0; }  order = order * i * 2; }
+	return order;
+}
+
+long long TypeBCoxeterSystem::rank_one_line(int one_line[])
+{
+	long long r = 0;
+	for (int i = 0; i < size; i++)
+	{
+		int c = 0;
+		for (int j = i+1; j < size; j++) { if (abs(one_line[j]) < abs(one_line[i])) { c++; } }
+		r = (r * (size - i)) + c;
+	}
+
+	for (int i = 0; i < size; i++)
+	{
+		r = 2*r;
+		if (one_line[i] < 0) { r++; }
+	}
+	return r;
+}
+
+void TypeBCoxeterSystem::unrank_one_line(long long r, int one_line[])
+{
+	int* signs = new int[size];
+	for (int i = size-1; i >= 0; i--)
+	{
+		signs[i] = (int) (r % 2);
+		r = r / 2;
+	}
+
+	int* code = new int[size];
+	for (int i = size-1; i >= 0; i--)
+	{
+		code[i] = (int) (r % (size - i));
+		r = r / (size - i);
+	}
+
+	// the ith entry is the code[i]th smallest value not used yet.
+	int* used = new int[size+1];
+	for (int v = 1; v <= size; v++) { used[v] = 0; }
+	for (int i = 0; i < size; i++)
+	{
+		int c = code[i];
+		int v = 1;
+		while (used[v] == 1 || c > 0) { if (used[v] == 0) { c--; } v++; }
+		used[v] = 1;
+		if (signs[i] == 1) { one_line[i] = 0 - v; } else { one_line[i] = v; }
+	}
+	one_line[size] = size+1;
+
+	delete[] signs;
+	delete[] code;
+	delete[] used;
+}
+
+int TypeBCoxeterSystem::has_one_line_descent(int one_line[], int i)
+{
+	if (i == 0) { return (one_line[0] < 0); }
+	return (one_line[i-1] > one_line[i]);
+}
+
+char TypeBCoxeterSystem::get_one_line_type()
+{
+	return 'B';
+}
+
+// The tableau criterion is exact in B_n (BB Theorem 8.1.8).
+int TypeBCoxeterSystem::bruhat_leq_one_line(int x[], int w[])
+{
+	return signed_tableau_leq(size, x, w);
+}
+
+
+/////////////////////////////////////////////////////////////////////
+
+// 0 from A20 on, where the order does not fit in a long long.
+long long TypeACoxeterSystem::get_one_line_order()
+{
+	long long order = 1;
+	for (int i = 1; i <= size+1; i++) { if (order > LLONG_MAX / i) { return 0; }  order = order * i; }
+	return order;
+}
+
+long long TypeACoxeterSystem::rank_one_line(int one_line[])
+{
+	long long r = 0;
+	for (int i = 0; i < size+1; i++)
+	{
+		int c = 0;
+		for (int j = i+1; j < size+1; j++) { if (one_line[j] < one_line[i]) { c++; } }
+		r = (r * (size + 1 - i)) + c;
+	}
+	return r;
+}
+
+void TypeACoxeterSystem::unrank_one_line(long long r, int one_line[])
+{
+	int* code = new int[size+1];
+	for (int i = size; i >= 0; i--)
+	{
+		code[i] = (int) (r % (size + 1 - i));
+		r = r / (size + 1 - i);
+	}
+
+	// the ith entry is the code[i]th smallest value not used yet.
+	int* used = new int[size+2];
+	for (int v = 1; v <= size+1; v++) { used[v] = 0; }
+	for (int i = 0; i < size+1; i++)
+	{
+		int c = code[i];
+		int v = 1;
+		while (used[v] == 1 || c > 0) { if (used[v] == 0) { c--; } v++; }
+		used[v] = 1;
+		one_line[i] = v;
+	}
+
+	delete[] code;
+	delete[] used;
+}
+
+int TypeACoxeterSystem::has_one_line_descent(int one_line[], int i)
+{
+	return (one_line[i] > one_line[i+1]);
+}
+
+char TypeACoxeterSystem::get_one_line_type()
+{
+	return 'A';
+}
+
+// x <= w iff x[i,j] <= w[i,j] for all i, j, where x[i,j] = #{ a <= i : x(a) >= j }.
+int TypeACoxeterSystem::bruhat_leq_one_line(int x[], int w[])
+{
+	int n = size+1;
+	int* x_count = new int[n+2];
+	int* w_count = new int[n+2];
+	for (int j = 0; j <= n+1; j++) { x_count[j] = 0;  w_count[j] = 0; }
+
+	int leq = 1;
+	for (int i = 0; i < n && leq == 1; i++)
+	{
+		for (int j = 1; j <= x[i]; j++) { x_count[j]++; }
+		for (int j = 1; j <= w[i]; j++) { w_count[j]++; }
+		for (int j = 1; j <= n; j++) { if (x_count[j] > w_count[j]) { leq = 0;  break; } }
+	}
+
+	delete[] x_count;
+	delete[] w_count;
+	return leq;
+}
+
+// The type B criterion is necessary for x <= w in D_n (BB Theorem 8.2.8), so it can rule comparisons out.
+int TypeDCoxeterSystem::bruhat_leq_one_line(int x[], int w[])
+{
+	if (signed_tableau_leq(size, x, w) == 0) { return 0; }
+	return -1;
+}
+
+
+/////////////////////////////////////////////////////////////////////
+
+// positions and values run over -n, ..., -1, 1, ..., n, with x(-a) = -x(a).
+int signed_tableau_leq(int n, int x[], int w[])
+{
+	// counts[v] = #{ a <= i : x(a) >= v }, with v shifted by n so that it is an index.
+	int* x_count = new int[2*n+2];
+	int* w_count = new int[2*n+2];
+	for (int v = 0; v < 2*n+2; v++) { x_count[v] = 0;  w_count[v] = 0; }
+
+	int leq = 1;
+	for (int a = -n; a <= n && leq == 1; a++)
+	{
+		if (a == 0) { continue; }
+
+		int xa = (a < 0) ? (0 - x[-a-1]) : x[a-1];
+		int wa = (a < 0) ? (0 - w[-a-1]) : w[a-1];
+		for (int v = 0; v <= xa+n; v++) { x_count[v]++; }
+		for (int v = 0; v <= wa+n; v++) { w_count[v]++; }
+		for (int v = 0; v <= 2*n; v++) { if (x_count[v] > w_count[v]) { leq = 0;  break; } }
+	}
+
+	delete[] x_count;
+	delete[] w_count;
+	return leq;
+}
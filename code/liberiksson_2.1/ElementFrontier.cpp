@@ -0,0 +1,67 @@
+#include "ElementFrontier.h"
+
+
+	ElementFrontier::ElementFrontier(CoxeterSystem* cs)
+	{
+		coxeter_system = cs;
+		size = cs->size;
+		count = 0;
+	}
+
+	ElementFrontier::~ElementFrontier()
+	{
+	}
+
+	void ElementFrontier::push(CoxeterElement& w)
+	{
+		words.insert(words.end(), w.word, w.word + size);
+		one_lines.insert(one_lines.end(), w.one_line, w.one_line + size+1);
+		heap_states.insert(heap_states.end(), w.heap_state, w.heap_state + 3*size);
+		heap_states.push_back(w.heap_valid);
+		lengths.push_back(w.length);
+		fingerprints.push_back(w.fingerprint);
+		count++;
+	}
+
+	void ElementFrontier::load(long long i, CoxeterElement& w)
+	{
+		NUMBERS_DATATYPE* word = &words[size * i];
+		for (int j = 0; j < size; j++) { w.word[j] = word[j]; }
+
+		int* one_line = &one_lines[(size+1) * i];
+		for (int j = 0; j < size+1; j++) { w.one_line[j] = one_line[j]; }
+
+		int* heap_state = &heap_states[(3*size + 1) * i];
+		for (int j = 0; j < 3*size; j++) { w.heap_state[j] = heap_state[j]; }
+		w.heap_valid = heap_state[3*size];
+
+		w.length = lengths[i];
+		w.fingerprint = fingerprints[i];
+	}
+
+	long long ElementFrontier::get_count()
+	{
+		return count;
+	}
+
+	void ElementFrontier::clear()
+	{
+		words.clear();
+		one_lines.clear();
+		heap_states.clear();
+		lengths.clear();
+		fingerprints.clear();
+		count = 0;
+	}
+
+	void ElementFrontier::swap(ElementFrontier& f)
+	{
+		words.swap(f.words);
+		one_lines.swap(f.one_lines);
+		heap_states.swap(f.heap_states);
+		lengths.swap(f.lengths);
+		fingerprints.swap(f.fingerprints);
+		long long c = count;
+		count = f.count;
+		f.count = c;
+	}
@@ -0,0 +1,46 @@
+#ifndef ELEMENTFRONTIER_H
+#define ELEMENTFRONTIER_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is one level of a breadth-first search:  a list of elements
+// of a Coxeter system stored as plain records in contiguous arrays
+// (the numbers game words, the one-line notations, the heap states,
+// and the lengths and fingerprints), instead of as CoxeterElements
+// which each allocate their own arrays.
+//
+// push() copies an element in, and load() copies record i back into
+// an existing CoxeterElement, so a search can run with one or two
+// scratch elements.  clear() empties the frontier but keeps the
+// arrays, so a search that alternates two frontiers (this level and
+// the next) stops allocating once they reach the size of the largest
+// level.
+//
+//////////////////////////////////////////////////////////////////////
+
+class ElementFrontier
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		int size;
+		long long count;
+
+		vector<NUMBERS_DATATYPE> words;  // words[size*i + j] = entry j of the word of element i.
+		vector<int> one_lines;  // (size+1) entries per element.
+		vector<int> heap_states;  // 3*size entries per element, followed by heap_valid.
+		vector<int> lengths;
+		vector<unsigned long long> fingerprints;
+
+		ElementFrontier::ElementFrontier(CoxeterSystem* cs);
+		ElementFrontier::~ElementFrontier();
+
+		void ElementFrontier::push(CoxeterElement& w);
+		void ElementFrontier::load(long long i, CoxeterElement& w);  // w must be an element of the same Coxeter system.
+		long long ElementFrontier::get_count();
+		void ElementFrontier::clear();
+		void ElementFrontier::swap(ElementFrontier& f);
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include "ElementIndex.h"
+
+
+	ElementIndex::ElementIndex(CoxeterSystem* cs)
+	{
+		coxeter_system = cs;
+		order = coxeter_system->get_one_line_order();
+		scratch = new int[coxeter_system->size + 1];
+
+		// an infinite group has order 0, and no ranks, and so does a finite group whose order does not fit in a long long.
+		chain = NULL;
+		if (order == 0 && coxeter_system->get_one_line_type() == 0 && coxeter_system->is_finite())
+		{
+			chain = new ParabolicChain(coxeter_system);
+			order = chain->get_order();
+			if (order == 0) { delete chain;  chain = NULL; }
+		}
+	}
+
+	ElementIndex::~ElementIndex()
+	{
+		if (chain != NULL) { delete chain; }
+		delete[] scratch;
+	}
+
+	long long ElementIndex::get_order()
+	{
+		return order;
+	}
+
+	long long ElementIndex::rank(CoxeterElement& w)
+	{
+		if (chain != NULL) { return chain->rank(w); }
+		return coxeter_system->rank_one_line(w.one_line);
+	}
+
+	CoxeterElement ElementIndex::unrank(long long r)
+	{
+		if (chain != NULL) { return chain->unrank(r); }
+
+		// strip right descents off the one-line notation, to read off a reduced word backwards.
+		int size = coxeter_system->size;
+		int* one_line = new int[size+1];
+		coxeter_system->unrank_one_line(r, one_line);
+
+		vector<int> reversed;
+		int s = 0;
+		while (s < size)
+		{
+			if (coxeter_system->has_one_line_descent(one_line, s))
+			{
+				coxeter_system->right_multiply(one_line, s);
+				reversed.push_back(s);
+				s = 0;
+			}
+			else { s++; }
+		}
+
+		CoxeterElement w = CoxeterElement(coxeter_system);
+		for (int i = reversed.size()-1; i >= 0; i--) { w.right_multiply(reversed[i]); }
+
+		delete[] one_line;
+		return w;
+	}
+
+	long long ElementIndex::right_multiply(CoxeterElement& w, long long r, int s)
+	{
+		if (chain != NULL) { return chain->right_multiply(r, s); }
+
+		for (int i = 0; i < coxeter_system->size + 1; i++) { scratch[i] = w.one_line[i]; }
+		coxeter_system->right_multiply(scratch, s);
+		return coxeter_system->rank_one_line(scratch);
+	}
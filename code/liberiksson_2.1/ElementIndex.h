@@ -0,0 +1,40 @@
+#ifndef ELEMENTINDEX_H
+#define ELEMENTINDEX_H
+
+#include "CoxeterElement.h"
+#include "ParabolicChain.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This numbers the elements of a finite Coxeter group 0, 1, ..., |W|-1, 
+// so that per-element data can be kept in flat arrays and bitsets 
+// rather than lists of CoxeterElements.
+//
+// Types with a faithful one-line notation (A, B and D) are
+// ranked directly from CoxeterElement::one_line.  The others are
+// ranked by their factorization along a ParabolicChain.  The order of
+// an infinite group is 0, and so is the order of a finite group that
+// does not fit in a long long (from A20, B17 and D17 on), which is
+// then not ranked either.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class ElementIndex
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		ParabolicChain* chain;  // NULL when the one-line notation is used.
+		long long order;
+		int* scratch;  // one-line notation workspace.
+
+		ElementIndex::ElementIndex(CoxeterSystem* cs);
+		ElementIndex::~ElementIndex();
+
+		long long ElementIndex::get_order();
+		long long ElementIndex::rank(CoxeterElement& w);
+		CoxeterElement ElementIndex::unrank(long long r);
+		long long ElementIndex::right_multiply(CoxeterElement& w, long long r, int s);  // index of w s, where w has index r.
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include "ElementSet.h"
+
+
+	ElementSet::ElementSet(int size)
+	{
+		this->size = size;
+		count = 0;
+		slots.assign(16, -1);
+	}
+
+	ElementSet::~ElementSet()
+	{
+	}
+
+	// the fingerprint is linear in the word, so the high bits are folded in before taking the slot.
+	long long ElementSet::get_slot(unsigned long long f)
+	{
+		f = (f ^ (f >> 32)) * 0xD6E8FEB86659FD93ULL;
+		return (long long) ((f ^ (f >> 32)) & (slots.size() - 1));
+	}
+
+	long long ElementSet::find(CoxeterElement& w)
+	{
+		long long slot = get_slot(w.fingerprint);
+		while (slots[slot] >= 0)
+		{
+			long long u = slots[slot];
+			if (fingerprints[u] == w.fingerprint)
+			{
+				int matches = 1;
+				for (int j = 0; j < size; j++)
+				{
+					if (words[(size * u) + j] != w.word[j]) { matches = 0; break; }
+				}
+				if (matches == 1) { return u; }
+			}
+			slot = (slot + 1) & (slots.size() - 1);
+		}
+		return -1;
+	}
+
+	long long ElementSet::insert(CoxeterElement& w)
+	{
+		long long u = find(w);
+		if (u >= 0) { return u; }
+
+		words.insert(words.end(), w.word, w.word + size);
+		fingerprints.push_back(w.fingerprint);
+		count++;
+
+		if (2 * count > slots.size()) { grow(); }
+		else
+		{
+			long long slot = get_slot(w.fingerprint);
+			while (slots[slot] >= 0) { slot = (slot + 1) & (slots.size() - 1); }
+			slots[slot] = count - 1;
+		}
+		return count - 1;
+	}
+
+	int ElementSet::contains(CoxeterElement& w)
+	{
+		return (find(w) >= 0) ? 1 : 0;
+	}
+
+	long long ElementSet::get_count()
+	{
+		return count;
+	}
+
+	// doubles the table (at least to 4 slots per element), and puts the elements back.
+	void ElementSet::grow()
+	{
+		long long capacity = 2 * slots.size();
+		while (capacity < 4 * count) { capacity = 2 * capacity; }
+		slots.assign(capacity, -1);
+
+		for (long long u = 0; u < count; u++)
+		{
+			long long slot = get_slot(fingerprints[u]);
+			while (slots[slot] >= 0) { slot = (slot + 1) & (slots.size() - 1); }
+			slots[slot] = u;
+		}
+	}
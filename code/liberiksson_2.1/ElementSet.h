@@ -0,0 +1,41 @@
+#ifndef ELEMENTSET_H
+#define ELEMENTSET_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is a hash set of elements of a Coxeter group, which numbers
+// them 0, 1, 2, ... in the order they are inserted.  It stores only
+// their numbers game words and fingerprints (so it works for infinite
+// groups, where ElementIndex cannot number the elements).
+//
+// Lookups start from the fingerprint each CoxeterElement already
+// carries, in a table with open addressing:  the words are only
+// compared when the fingerprints agree.
+//
+//////////////////////////////////////////////////////////////////////
+
+class ElementSet
+{
+	public:
+		int size;
+		long long count;
+
+		vector<NUMBERS_DATATYPE> words;  // words[size*i + j] = entry j of the word of element i.
+		vector<unsigned long long> fingerprints;
+		vector<long long> slots;  // open addressing:  element numbers, or -1.  The capacity is a power of 2.
+
+		ElementSet::ElementSet(int size);
+		ElementSet::~ElementSet();
+
+		long long ElementSet::find(CoxeterElement& w);  // the number of w, or -1.
+		long long ElementSet::insert(CoxeterElement& w);  // the number of w, which is count-1 if it was not in the set.
+		int ElementSet::contains(CoxeterElement& w);
+		long long ElementSet::get_count();
+
+		long long ElementSet::get_slot(unsigned long long f);
+		void ElementSet::grow();
+};
+
+#endif
@@ -0,0 +1,77 @@
+#include "GroupEnumerator.h"
+
+
+	GroupEnumerator::GroupEnumerator(CoxeterSystem* cs, int max_length) : current(cs)
+	{
+		coxeter_system = cs;
+		this->max_length = max_length;
+
+		next_generator = 0;
+		started = 0;
+		exhausted_flag = 0;
+	}
+
+	int GroupEnumerator::exhausted()
+	{
+		return exhausted_flag;
+	}
+
+	CoxeterElement& GroupEnumerator::get_element()
+	{
+		return current;
+	}
+
+	int GroupEnumerator::get_first_descent(CoxeterElement& w)
+	{
+		for (int s = 0; s < w.size; s++)
+		{
+			if (w.word[s] < 0) { return s; }
+		}
+		return -1;
+	}
+
+	int GroupEnumerator::next()
+	{
+		if (exhausted_flag == 1) { return 0; }
+
+		// the identity is the root of the tree.
+		if (started == 0) { started = 1; return 1; }
+
+		while (1==1)
+		{
+			// look for the next child of current.
+			if (max_length <= 0 || current.length < max_length)
+			{
+				for (int s = next_generator; s < current.size; s++)
+				{
+					if (current.word[s] < 0) { continue; }
+
+					current.right_multiply(s);
+					if (get_first_descent(current) == s)
+					{
+						next_generator = 0;
+						return 1;
+					}
+					current.right_multiply(s);  // not a child, so undo.
+				}
+			}
+
+			// no children are left, so return to the parent and try its next child.
+			int s = get_first_descent(current);
+			if (s < 0) { exhausted_flag = 1; return 0; }
+
+			current.right_multiply(s);
+			next_generator = s+1;
+		}
+	}
+
+	long long GroupEnumerator::for_each(int (*visit)(CoxeterElement& w, void* data), void* data)
+	{
+		long long count = 0;
+		while (next())
+		{
+			count++;
+			if (visit(current, data) == 0) { break; }
+		}
+		return count;
+	}
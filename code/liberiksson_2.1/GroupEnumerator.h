@@ -0,0 +1,48 @@
+#ifndef GROUPENUMERATOR_H
+#define GROUPENUMERATOR_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This enumerates every element of a Coxeter group exactly once, by
+// reverse search (Avis-Fukuda) on the tree in which the parent of
+// w != e is w s, where s is the smallest right descent of w.  
+//
+// The children of u are the u s with s a right ascent of u such that
+// u s has no right descent smaller than s, so a depth-first walk of the
+// tree only needs the current element:  we return from a child to its
+// parent by multiplying by the smallest right descent again.  Hence the
+// working memory is O(rank), independent of the size of the group.
+//
+// Elements are produced in a fixed (canonical) order, with the identity
+// first.  An optional max_length > 0 restricts to elements of length at 
+// most max_length.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class GroupEnumerator
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		CoxeterElement current;
+		int max_length;
+
+		int next_generator;  // the next generator to try as a child of current.
+		int started;
+		int exhausted_flag;
+
+		GroupEnumerator::GroupEnumerator(CoxeterSystem* cs, int max_length);
+
+		int GroupEnumerator::next();  // moves current to the next element, returns 0 when there are none left.
+		int GroupEnumerator::exhausted();
+		CoxeterElement& GroupEnumerator::get_element();
+
+		// calls visit(w, data) on each element w in turn, stopping early if visit returns 0.  Returns the number of elements visited.
+		long long GroupEnumerator::for_each(int (*visit)(CoxeterElement& w, void* data), void* data);
+
+		int GroupEnumerator::get_first_descent(CoxeterElement& w);  // smallest right descent of w, or -1 if w is the identity.
+};
+
+#endif
@@ -0,0 +1,179 @@
+#include "HeapEnumerator.h"
+
+
+	HeapEnumerator::HeapEnumerator(CoxeterSystem* cs, int length)
+	{
+		coxeter_system = cs;
+		size = coxeter_system->size;
+		target_length = length;
+
+		// every layer has at least one generator, so there are at most length layers.
+		layer = new unsigned long long[length+1];
+		candidates = new unsigned long long[length+1];
+		layer_length = new int[length+1];
+		counts = new int[size * (length+1)];
+
+		neighbor_mask = new unsigned long long[size];
+		for (int s = 0; s < size; s++)
+		{
+			neighbor_mask[s] = 0;
+			for (int k = 0; k < coxeter_system->get_degree(s); k++)
+			{ neighbor_mask[s] |= (1ULL << coxeter_system->get_neighbor(s,k)); }
+		}
+
+		depth = 0;
+		layer_length[0] = 0;
+		for (int s = 0; s < size; s++) { counts[s] = -1; }
+
+		started = 0;
+		exhausted_flag = 0;
+	}
+
+	HeapEnumerator::~HeapEnumerator()
+	{
+		delete[] layer;
+		delete[] candidates;
+		delete[] layer_length;
+		delete[] counts;
+		delete[] neighbor_mask;
+	}
+
+	int HeapEnumerator::exhausted()
+	{
+		return exhausted_flag;
+	}
+
+	// generators that may appear in layer d:  they must be covered by layer d-1, and placing them must not create a short braid.
+	unsigned long long HeapEnumerator::get_candidates(int d)
+	{
+		unsigned long long cover = 0;
+		if (d == 0) { cover = ~0ULL; }
+		else
+		{
+			for (int s = 0; s < size; s++)
+			{
+				if ((layer[d-1] >> s) & 1) { cover |= neighbor_mask[s]; }
+			}
+		}
+
+		unsigned long long c = 0;
+		for (int s = 0; s < size; s++)
+		{
+			int n = counts[ (size * d) + s ];
+			if (((cover >> s) & 1) && (n < 0 || n >= 2)) { c |= (1ULL << s); }
+		}
+		return c;
+	}
+
+	// the next nonempty subset of candidates[d] (in increasing binary order) that commutes and still fits in target_length, or 0.
+	unsigned long long HeapEnumerator::next_layer(int d)
+	{
+		unsigned long long c = candidates[d];
+		unsigned long long sub = layer[d];
+		int room = target_length - layer_length[d];
+
+		while (1==1)
+		{
+			sub = (sub - c) & c;
+			if (sub == 0) { return 0; }
+
+			if (__builtin_popcountll(sub) > room) { continue; }
+
+			int commutes = 1;
+			for (int s = 0; s < size; s++)
+			{
+				if (((sub >> s) & 1) && (neighbor_mask[s] & sub) != 0) { commutes = 0; break; }
+			}
+			if (commutes == 1) { return sub; }
+		}
+	}
+
+	// record layer d in the heap counts.  Generators in one layer commute, so they can be added in any order.
+	void HeapEnumerator::place_layer(int d)
+	{
+		int* before = counts + (size * d);
+		int* after = counts + (size * (d+1));
+		for (int s = 0; s < size; s++) { after[s] = before[s]; }
+
+		for (int s = 0; s < size; s++)
+		{
+			if (((layer[d] >> s) & 1) == 0) { continue; }
+
+			after[s] = 0;
+			for (int k = 0; k < coxeter_system->get_degree(s); k++)
+			{
+				int t = coxeter_system->get_neighbor(s,k);
+				if (after[t] >= 0 && after[t] < 2) { after[t]++; }
+			}
+		}
+
+		layer_length[d+1] = layer_length[d] + __builtin_popcountll(layer[d]);
+	}
+
+	// depth-first search over the layers, stopping at each heap of the target length.
+	int HeapEnumerator::next()
+	{
+		if (exhausted_flag == 1) { return 0; }
+
+		// the identity is the only heap with no layers.
+		if (target_length == 0)
+		{
+			if (started == 1) { exhausted_flag = 1; return 0; }
+			started = 1;
+			return 1;
+		}
+
+		int open_layer = (started == 0);  // 1 = start a new layer on top, 0 = advance the top layer.
+		started = 1;
+
+		while (1==1)
+		{
+			if (open_layer == 1)
+			{
+				candidates[depth] = get_candidates(depth);
+				layer[depth] = 0;
+				depth++;
+			}
+
+			int d = depth-1;
+			unsigned long long sub = next_layer(d);
+			if (sub == 0)
+			{
+				depth--;
+				if (depth == 0) { exhausted_flag = 1; return 0; }
+				open_layer = 0;
+				continue;
+			}
+
+			layer[d] = sub;
+			place_layer(d);
+
+			if (layer_length[d+1] == target_length) { return 1; }
+			open_layer = 1;
+		}
+	}
+
+	void HeapEnumerator::get_reduced_expression(int reduced[])
+	{
+		int i = 0;
+		for (int d = 0; d < depth; d++)
+		{
+			for (int s = 0; s < size; s++)
+			{
+				if ((layer[d] >> s) & 1) { reduced[i] = s; i++; }
+			}
+		}
+	}
+
+	void HeapEnumerator::print_layers()
+	{
+		for (int d = 0; d < depth; d++)
+		{
+			cout << "{ ";
+			for (int s = 0; s < size; s++)
+			{
+				if ((layer[d] >> s) & 1) { cout << s << " "; }
+			}
+			cout << "}";
+		}
+	}
@@ -0,0 +1,55 @@
+#ifndef HEAPENUMERATOR_H
+#define HEAPENUMERATOR_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This enumerates the short-braid-avoiding elements of a given length
+// directly as heaps, following Stembridge's "The enumeration of fully
+// commutative elements of Coxeter groups."  (In the simply-laced types
+// these are exactly the fully commutative elements.)
+//
+// Each heap is generated once, in Cartier-Foata normal form:  a
+// sequence of layers, each a set of pairwise commuting generators,
+// where every generator in a layer fails to commute with (or equals)
+// some generator of the previous layer.  Distinct normal forms are
+// distinct elements, so no visited list or numbers game is needed,
+// and the working memory is O(length * rank).
+//
+// Generators are stored in the bits of an unsigned long long, so the
+// rank is at most 64.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class HeapEnumerator
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		int size;
+		int target_length;  // only heaps with exactly this many generators are produced.
+
+		int depth;  // number of layers currently placed.
+		unsigned long long* layer;  // layer[d] = generators in layer d.
+		unsigned long long* candidates;  // candidates[d] = generators allowed in layer d by the layers below it.
+		int* layer_length;  // layer_length[d] = number of generators in layers 0, ..., d-1.
+		int* counts;  // counts[size*d + s] = generators not commuting with s after its last occurrence in layers 0, ..., d-1 (saturated at 2, -1 if s does not occur).
+		unsigned long long* neighbor_mask;  // neighbor_mask[s] = generators not commuting with s.
+		int started;
+		int exhausted_flag;
+
+		HeapEnumerator::HeapEnumerator(CoxeterSystem* cs, int length);
+		HeapEnumerator::~HeapEnumerator();
+
+		int HeapEnumerator::next();  // moves to the next heap, returns 0 when there are none left.
+		int HeapEnumerator::exhausted();
+		void HeapEnumerator::get_reduced_expression(int reduced[]);  // layer by layer, requires an array of length at least target_length.
+		void HeapEnumerator::print_layers();
+
+		unsigned long long HeapEnumerator::get_candidates(int d);
+		unsigned long long HeapEnumerator::next_layer(int d);
+		void HeapEnumerator::place_layer(int d);
+};
+
+#endif
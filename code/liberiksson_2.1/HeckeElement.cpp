@@ -0,0 +1,357 @@
+#include "HeckeElement.h"
+#include <algorithm>
+
+struct PendingOrder
+{
+	int* keys;
+	bool operator()(int a, int b) const { return keys[a] < keys[b]; }
+};
+
+
+	HeckeElement::HeckeElement(CayleyTable* t)
+	{
+		table = t;
+		start.push_back(0);
+		pending_start.push_back(0);
+	}
+
+	HeckeElement::HeckeElement(CayleyTable* t, long long x)
+	{
+		table = t;
+		start.push_back(0);
+		pending_start.push_back(0);
+		set_T(x);
+	}
+
+	void HeckeElement::set_zero()
+	{
+		elements.clear();
+		low.clear();
+		start.clear();
+		start.push_back(0);
+		coefficients.clear();
+
+		pending_elements.clear();
+		pending_low.clear();
+		pending_start.clear();
+		pending_start.push_back(0);
+		pending_coefficients.clear();
+	}
+
+	void HeckeElement::set_T(long long x)
+	{
+		set_zero();
+		elements.push_back((int) x);
+		low.push_back(0);
+		coefficients.push_back(1);
+		start.push_back(1);
+	}
+
+	int HeckeElement::get_term_count()
+	{
+		normalize();
+		return elements.size();
+	}
+
+	int HeckeElement::is_zero()
+	{
+		return (get_term_count() == 0);
+	}
+
+	int HeckeElement::equals(HeckeElement& h)
+	{
+		normalize();
+		h.normalize();
+		return (elements == h.elements && low == h.low && start == h.start && coefficients == h.coefficients);
+	}
+
+	void HeckeElement::append(int x, int term_low, const int c[], int n, int sign)
+	{
+		pending_elements.push_back(x);
+		pending_low.push_back(term_low);
+		for (int k = 0; k < n; k++) { pending_coefficients.push_back(sign * c[k]); }
+		pending_start.push_back(pending_coefficients.size());
+	}
+
+	void HeckeElement::add_term(long long x, int term_low, int c[], int n)
+	{
+		append((int) x, term_low, c, n, 1);
+	}
+
+	void HeckeElement::add(HeckeElement& h)
+	{
+		h.normalize();
+		for (int i = 0; i < h.elements.size(); i++)
+		{ append(h.elements[i], h.low[i], &(h.coefficients[ h.start[i] ]), h.start[i+1] - h.start[i], 1); }
+	}
+
+	void HeckeElement::append_product(HeckeElement& h, int term_low, const int c[], int n)
+	{
+		h.normalize();
+		for (int i = 0; i < h.elements.size(); i++)
+		{
+			int m = h.start[i+1] - h.start[i];
+			sum.assign(m + n - 1, 0);
+			for (int j = 0; j < m; j++)
+			{
+				for (int k = 0; k < n; k++) { sum[j+k] += h.coefficients[ h.start[i] + j ] * c[k]; }
+			}
+			append(h.elements[i], h.low[i] + term_low, &(sum[0]), m + n - 1, 1);
+		}
+	}
+
+	// sort the pending terms (together with the current ones) by element, and add up the polynomials of each element.
+	void HeckeElement::normalize()
+	{
+		if (pending_elements.size() == 0) { return; }
+
+		for (int i = 0; i < elements.size(); i++)
+		{ append(elements[i], low[i], &(coefficients[ start[i] ]), start[i+1] - start[i], 1); }
+		elements.clear();
+		low.clear();
+		start.clear();
+		start.push_back(0);
+		coefficients.clear();
+
+		int n = pending_elements.size();
+		order.resize(n);
+		for (int i = 0; i < n; i++) { order[i] = i; }
+		PendingOrder by_element;
+		by_element.keys = &(pending_elements[0]);
+		sort(order.begin(), order.end(), by_element);
+
+		int i = 0;
+		while (i < n)
+		{
+			int x = pending_elements[ order[i] ];
+			int j = i;
+			int min_low = pending_low[ order[i] ];
+			int max_high = min_low - 1;
+			while (j < n && pending_elements[ order[j] ] == x)
+			{
+				int t = order[j];
+				int high = pending_low[t] + (pending_start[t+1] - pending_start[t]) - 1;
+				if (pending_low[t] < min_low) { min_low = pending_low[t]; }
+				if (high > max_high) { max_high = high; }
+				j++;
+			}
+
+			sum.assign(max_high - min_low + 1, 0);
+			for (int k = i; k < j; k++)
+			{
+				int t = order[k];
+				for (int m = pending_start[t]; m < pending_start[t+1]; m++)
+				{ sum[ pending_low[t] - min_low + (m - pending_start[t]) ] += pending_coefficients[m]; }
+			}
+
+			int first = 0;
+			int last = max_high - min_low;
+			while (first <= last && sum[first] == 0) { first++; }
+			while (last >= first && sum[last] == 0) { last--; }
+			if (first <= last)
+			{
+				elements.push_back(x);
+				low.push_back(min_low + first);
+				for (int m = first; m <= last; m++) { coefficients.push_back(sum[m]); }
+				start.push_back(coefficients.size());
+			}
+			i = j;
+		}
+
+		pending_elements.clear();
+		pending_low.clear();
+		pending_start.clear();
+		pending_start.push_back(0);
+		pending_coefficients.clear();
+	}
+
+	void HeckeElement::right_multiply_T(int s)
+	{
+		normalize();
+		for (int i = 0; i < elements.size(); i++)
+		{
+			int x = elements[i];
+			int xs = (int) table->right_multiply(x, s);
+			int* c = &(coefficients[ start[i] ]);
+			int n = start[i+1] - start[i];
+
+			if (table->has_right_descent(x, s) == 0) { append(xs, low[i], c, n, 1); }
+			else
+			{
+				// (q-1) T_x + q T_{xs}
+				append(x, low[i] + 2, c, n, 1);
+				append(x, low[i], c, n, -1);
+				append(xs, low[i] + 2, c, n, 1);
+			}
+		}
+		elements.clear();
+		low.clear();
+		start.clear();
+		start.push_back(0);
+		coefficients.clear();
+		normalize();
+	}
+
+	// T_s^{-1} = q^{-1} T_s + (q^{-1} - 1).
+	void HeckeElement::right_multiply_T_inverse(int s)
+	{
+		normalize();
+		for (int i = 0; i < elements.size(); i++)
+		{
+			int x = elements[i];
+			int xs = (int) table->right_multiply(x, s);
+			int* c = &(coefficients[ start[i] ]);
+			int n = start[i+1] - start[i];
+
+			if (table->has_right_descent(x, s) == 1) { append(xs, low[i], c, n, 1); }
+			else
+			{
+				append(xs, low[i] - 2, c, n, 1);
+				append(x, low[i] - 2, c, n, 1);
+				append(x, low[i], c, n, -1);
+			}
+		}
+		elements.clear();
+		low.clear();
+		start.clear();
+		start.push_back(0);
+		coefficients.clear();
+		normalize();
+	}
+
+	void HeckeElement::right_multiply_C(int s)
+	{
+		normalize();
+		for (int i = 0; i < elements.size(); i++)
+		{
+			int x = elements[i];
+			int xs = (int) table->right_multiply(x, s);
+			int* c = &(coefficients[ start[i] ]);
+			int n = start[i+1] - start[i];
+
+			// v^{-1} (T_{xs} + T_x) if xs > x, and v (T_{xs} + T_x) if xs < x.
+			int shift = (table->has_right_descent(x, s) == 1) ? 1 : -1;
+			append(xs, low[i] + shift, c, n, 1);
+			append(x, low[i] + shift, c, n, 1);
+		}
+		elements.clear();
+		low.clear();
+		start.clear();
+		start.push_back(0);
+		coefficients.clear();
+		normalize();
+	}
+
+	// a reduced expression for x, found by stripping off right descents.
+	int HeckeElement::get_reduced_expression(long long x, int reduced[])
+	{
+		int length = table->get_length(x);
+		for (int k = length-1; k >= 0; k--)
+		{
+			int s = __builtin_ctz(table->descents[x]);
+			reduced[k] = s;
+			x = table->right_multiply(x, s);
+		}
+		return length;
+	}
+
+	void HeckeElement::multiply(HeckeElement& h)
+	{
+		normalize();
+		h.normalize();
+
+		HeckeElement product(table);
+		HeckeElement term(table);
+		vector<int> reduced;
+		for (int i = 0; i < h.elements.size(); i++)
+		{
+			// this T_y p_y(v), with T_y = T_{s_1} ... T_{s_k}.
+			term.set_zero();
+			term.add(*this);
+			reduced.resize(table->get_length(h.elements[i]) + 1);
+			int length = get_reduced_expression(h.elements[i], &(reduced[0]));
+			for (int k = 0; k < length; k++) { term.right_multiply_T(reduced[k]); }
+			product.append_product(term, h.low[i], &(h.coefficients[ h.start[i] ]), h.start[i+1] - h.start[i]);
+		}
+
+		set_zero();
+		add(product);
+		normalize();
+	}
+
+	void HeckeElement::bar()
+	{
+		normalize();
+
+		HeckeElement result(table);
+		HeckeElement term(table);
+		vector<int> reduced;
+		vector<int> reversed;
+		for (int i = 0; i < elements.size(); i++)
+		{
+			// bar(T_{s_1} ... T_{s_k}) = T_{s_1}^{-1} ... T_{s_k}^{-1}.
+			term.set_T(table->identity);
+			reduced.resize(table->get_length(elements[i]) + 1);
+			int length = get_reduced_expression(elements[i], &(reduced[0]));
+			for (int k = 0; k < length; k++) { term.right_multiply_T_inverse(reduced[k]); }
+
+			// bar(v^low (c_0 + ... + c_{n-1} v^{n-1})) = v^{-low-n+1} (c_{n-1} + ... + c_0 v^{n-1}).
+			int n = start[i+1] - start[i];
+			reversed.resize(n);
+			for (int k = 0; k < n; k++) { reversed[k] = coefficients[ start[i] + n - 1 - k ]; }
+			result.append_product(term, -low[i] - n + 1, &(reversed[0]), n);
+		}
+
+		set_zero();
+		add(result);
+		normalize();
+	}
+
+	// e.g. "(v^-1 + v) T( 0 ) + v^-1 T( )".
+	void HeckeElement::sprint(string& s)
+	{
+		normalize();
+		s = "";
+		if (elements.size() == 0) { s = "0";  return; }
+
+		for (int i = 0; i < elements.size(); i++)
+		{
+			if (i > 0) { s = s + " + "; }
+
+			string polynomial;
+			int terms = 0;
+			for (int m = start[i]; m < start[i+1]; m++)
+			{
+				int c = coefficients[m];
+				int k = low[i] + (m - start[i]);
+				if (c == 0) { continue; }
+
+				if (terms > 0) { polynomial = polynomial + ((c < 0) ? " - " : " + "); }
+				else if (c < 0) { polynomial = polynomial + "-"; }
+				if (c < 0) { c = -c; }
+
+				stringstream monomial;
+				if (k == 0) { monomial << c; }
+				else
+				{
+					if (c != 1) { monomial << c << "."; }
+					monomial << "v";
+					if (k != 1) { monomial << "^" << k; }
+				}
+				polynomial = polynomial + monomial.str();
+				terms++;
+			}
+			if (terms > 1) { polynomial = "(" + polynomial + ")"; }
+
+			string name;
+			table->sprint_reduced_expression(elements[i], name);
+			s = s + polynomial + " T" + name;
+		}
+	}
+
+	void HeckeElement::print()
+	{
+		string s;
+		sprint(s);
+		cout << s << endl;
+	}
@@ -0,0 +1,72 @@
+#ifndef HECKEELEMENT_H
+#define HECKEELEMENT_H
+
+#include "CayleyTable.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is an element of the Hecke algebra of a small finite Coxeter 
+// group, written in the T-basis with Laurent polynomial coefficients 
+// in v, where q = v^2:
+//
+//   h = sum_x p_x(v) T_x,   T_x T_s = T_{xs} if xs > x, and
+//                           T_x T_s = (q-1) T_x + q T_{xs} if xs < x.
+//
+// The Kazhdan-Lusztig basis element is C'_w = v^{-l(w)} sum_x P_{x,w}(q) T_x.
+//
+// Elements x are indices into a CayleyTable.  The terms are kept in 
+// flat arrays sorted by x:  term i is 
+//
+//   v^{low[i]} (coefficients[start[i]] + coefficients[start[i]+1] v + ... ) T_{elements[i]}.
+//
+// Operations write their terms to a second set of arrays (pending)
+// which is then sorted and merged, so repeated operations reuse the 
+// same memory instead of allocating.
+//
+//////////////////////////////////////////////////////////////////////
+
+class HeckeElement
+{
+	public:
+		CayleyTable* table;  // table is not allocated in this class.
+
+		vector<int> elements;
+		vector<int> low;
+		vector<int> start;  // one more entry than elements.
+		vector<int> coefficients;
+
+		vector<int> pending_elements;
+		vector<int> pending_low;
+		vector<int> pending_start;
+		vector<int> pending_coefficients;
+		vector<int> order;  // workspace for sorting the pending terms.
+		vector<int> sum;  // workspace for merging polynomials.
+
+		HeckeElement::HeckeElement(CayleyTable* t);  // zero.
+		HeckeElement::HeckeElement(CayleyTable* t, long long x);  // T_x.
+
+		void HeckeElement::set_zero();
+		void HeckeElement::set_T(long long x);
+		int HeckeElement::get_term_count();
+		int HeckeElement::is_zero();
+		int HeckeElement::equals(HeckeElement& h);
+
+		void HeckeElement::add_term(long long x, int term_low, int c[], int n);  // adds v^term_low (c[0] + c[1] v + ... + c[n-1] v^{n-1}) T_x.
+		void HeckeElement::add(HeckeElement& h);
+		void HeckeElement::normalize();  // merges the terms added with add_term().
+
+		void HeckeElement::right_multiply_T(int s);
+		void HeckeElement::right_multiply_T_inverse(int s);
+		void HeckeElement::right_multiply_C(int s);  // by C'_s = v^{-1} (T_s + 1).
+		void HeckeElement::multiply(HeckeElement& h);  // this = this h.
+		void HeckeElement::bar();  // v -> v^{-1}, T_x -> T_{x^{-1}}^{-1}.
+
+		int HeckeElement::get_reduced_expression(long long x, int reduced[]);
+		void HeckeElement::sprint(string& s);
+		void HeckeElement::print();
+
+		void HeckeElement::append(int x, int term_low, const int c[], int n, int sign);
+		void HeckeElement::append_product(HeckeElement& h, int term_low, const int c[], int n);  // adds (v^term_low c) h.
+};
+
+#endif
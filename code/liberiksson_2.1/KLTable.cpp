@@ -0,0 +1,281 @@
+#include "KLTable.h"
+#include <algorithm>
+
+
+	KLTable::KLTable(BruhatInterval* bi)
+	{
+		interval = bi;
+		size = interval->size;
+		count = interval->count;
+
+		pool_start.push_back(0);
+		pool_hash.assign(1024, -1);
+		int zero[1] = {0};
+		int one[1] = {1};
+		intern(zero, -1);
+		intern(one, 0);
+
+		int* lengths = interval->lengths;
+		int* products = interval->products;
+		unsigned long long* descents = interval->descents;
+
+		int* below_stamp = new int[count];  // below_stamp[u] == y when u <= v has been reached for row y.
+		int* row_stamp = new int[count];  // row_stamp[x] == y when x has been put in row y.
+		for (int i = 0; i < count; i++) { below_stamp[i] = -1;  row_stamp[i] = -1; }
+		vector<int> below;
+		vector<int> candidates;
+		int* coefficients = new int[ interval->top_length + 2 ];
+
+		for (int y = 0; y < count; y++)
+		{
+			row_start.push_back(row_x.size());
+			mu_start.push_back(mu_z.size());
+
+			if (lengths[y] == 0)
+			{
+				row_x.push_back(y);
+				row_polynomial.push_back(1);
+				continue;
+			}
+
+			int s = __builtin_ctzll(descents[y]);
+			int v = products[(size * y) + s];
+			unsigned long long v_descents = descents[v];
+
+			// list all u <= v, by going down from each extremal element of row v within its coset for D_R(v).
+			below.clear();
+			for (long long k = row_start[v]; k < row_start[v+1]; k++)
+			{
+				int u = row_x[k];
+				if (below_stamp[u] == y) { continue; }
+				below_stamp[u] = y;
+				int first = below.size();
+				below.push_back(u);
+				for (int b = first; b < below.size(); b++)
+				{
+					unsigned long long m = descents[ below[b] ] & v_descents;
+					while (m != 0)
+					{
+						int t = __builtin_ctzll(m);
+						m &= m - 1;
+						int lower = products[(size * below[b]) + t];
+						if (below_stamp[lower] != y) { below_stamp[lower] = y;  below.push_back(lower); }
+					}
+				}
+			}
+
+			// the extremal x <= y are the x = u s > u with D_R(y) contained in D_R(x).
+			candidates.clear();
+			for (int b = 0; b < below.size(); b++)
+			{
+				int x = products[(size * below[b]) + s];
+				if (lengths[x] < lengths[ below[b] ]) { continue; }
+				if ((descents[x] & descents[y]) != descents[y]) { continue; }
+				if (row_stamp[x] != y) { row_stamp[x] = y;  candidates.push_back(x); }
+			}
+			sort(candidates.begin(), candidates.end());
+
+			for (int c = 0; c < candidates.size(); c++)
+			{
+				int x = candidates[c];
+				int degree = -1;
+				for (int k = 0; k <= lengths[y]; k++) { coefficients[k] = 0; }
+
+				// P_{xs,v} + q P_{x,v}
+				int p = get_polynomial(products[(size * x) + s], v);
+				for (int k = 0; k <= get_degree(p); k++) { coefficients[k] += get_coefficient(p, k); }
+				if (get_degree(p) > degree) { degree = get_degree(p); }
+				p = get_polynomial(x, v);
+				for (int k = 0; k <= get_degree(p); k++) { coefficients[k+1] += get_coefficient(p, k); }
+				if (get_degree(p) + 1 > degree) { degree = get_degree(p) + 1; }
+
+				// - sum mu(z,v) q^{(l(y)-l(z))/2} P_{x,z}
+				for (long long k = mu_start[v]; k < mu_start[v+1]; k++)
+				{
+					int z = mu_z[k];
+					if (lengths[z] < lengths[x] || lengths[ products[(size * z) + s] ] > lengths[z]) { continue; }
+					p = get_polynomial(x, z);
+					int shift = (lengths[y] - lengths[z]) / 2;
+					for (int j = 0; j <= get_degree(p); j++) { coefficients[j+shift] -= mu_value[k] * get_coefficient(p, j); }
+				}
+
+				while (degree >= 0 && coefficients[degree] == 0) { degree--; }
+				if (x != y && 2*degree > lengths[y] - lengths[x] - 1) { cout << "ERROR:  P_{x,y} has too large a degree." << endl; }
+
+				p = intern(coefficients, degree);
+				row_x.push_back(x);
+				row_polynomial.push_back(p);
+
+				if ((lengths[y] - lengths[x]) % 2 == 1)
+				{
+					int top = (lengths[y] - lengths[x] - 1) / 2;
+					if (top <= degree)
+					{
+						mu_z.push_back(x);
+						mu_value.push_back(coefficients[top]);
+					}
+				}
+			}
+
+			// the coatoms y t < y for right descents t are the other z with mu(z,y) != 0.
+			unsigned long long m = descents[y];
+			while (m != 0)
+			{
+				int t = __builtin_ctzll(m);
+				m &= m - 1;
+				mu_z.push_back(products[(size * y) + t]);
+				mu_value.push_back(1);
+			}
+		}
+		row_start.push_back(row_x.size());
+		mu_start.push_back(mu_z.size());
+
+		delete[] below_stamp;
+		delete[] row_stamp;
+		delete[] coefficients;
+	}
+
+	int KLTable::lift(int x, int y)
+	{
+		unsigned long long m = interval->descents[y] & ~(interval->descents[x]);
+		while (m != 0)
+		{
+			x = interval->products[(size * x) + __builtin_ctzll(m)];
+			if (x < 0) { return -1; }
+			m = interval->descents[y] & ~(interval->descents[x]);
+		}
+		return x;
+	}
+
+	int KLTable::find_row(int x, int y)
+	{
+		long long low = row_start[y];
+		long long high = row_start[y+1] - 1;
+		while (low <= high)
+		{
+			long long mid = (low + high) / 2;
+			if (row_x[mid] == x) { return row_polynomial[mid]; }
+			if (row_x[mid] < x) { low = mid + 1; }
+			else { high = mid - 1; }
+		}
+		return 0;
+	}
+
+	int KLTable::get_polynomial(int x, int y)
+	{
+		if (x < 0 || interval->lengths[x] > interval->lengths[y]) { return 0; }
+		x = lift(x, y);
+		if (x < 0) { return 0; }
+		return find_row(x, y);
+	}
+
+	int KLTable::get_mu(int x, int y)
+	{
+		int d = interval->lengths[y] - interval->lengths[x];
+		if (d % 2 == 0 || d < 0) { return 0; }
+		int p = get_polynomial(x, y);
+		return get_coefficient(p, (d - 1) / 2);
+	}
+
+	int KLTable::get_degree(int p)
+	{
+		return pool_start[p+1] - pool_start[p] - 1;
+	}
+
+	int KLTable::get_coefficient(int p, int k)
+	{
+		if (k < 0 || k > get_degree(p)) { return 0; }
+		return pool_coefficients[ pool_start[p] + k ];
+	}
+
+	int KLTable::get_pool_size()
+	{
+		return pool_start.size() - 1;
+	}
+
+	long long KLTable::get_stored_pairs()
+	{
+		return row_x.size();
+	}
+
+	unsigned long long KLTable::hash_polynomial(int coefficients[], int degree)
+	{
+		unsigned long long h = 14695981039346656037ULL ^ (unsigned int) degree;
+		for (int k = 0; k <= degree; k++) { h = (h ^ (unsigned int) coefficients[k]) * 1099511628211ULL; }
+		return h ^ (h >> 29);
+	}
+
+	// the pool number of this polynomial, adding it to the pool if it is new.
+	int KLTable::intern(int coefficients[], int degree)
+	{
+		int capacity = pool_hash.size();
+		int slot = (int) (hash_polynomial(coefficients, degree) & (capacity - 1));
+		while (pool_hash[slot] >= 0)
+		{
+			int p = pool_hash[slot];
+			if (get_degree(p) == degree)
+			{
+				int matches = 1;
+				for (int k = 0; k <= degree; k++)
+				{
+					if (pool_coefficients[ pool_start[p] + k ] != coefficients[k]) { matches = 0;  break; }
+				}
+				if (matches == 1) { return p; }
+			}
+			slot = (slot + 1) & (capacity - 1);
+		}
+
+		int p = get_pool_size();
+		for (int k = 0; k <= degree; k++) { pool_coefficients.push_back(coefficients[k]); }
+		pool_start.push_back(pool_coefficients.size());
+		pool_hash[slot] = p;
+
+		if (4 * get_pool_size() > capacity) { grow_pool_hash(); }
+		return p;
+	}
+
+	void KLTable::grow_pool_hash()
+	{
+		int capacity = 2 * pool_hash.size();
+		pool_hash.assign(capacity, -1);
+		for (int p = 0; p < get_pool_size(); p++)
+		{
+			int slot = (int) (hash_polynomial(&(pool_coefficients[ pool_start[p] ]), get_degree(p)) & (capacity - 1));
+			while (pool_hash[slot] >= 0) { slot = (slot + 1) & (capacity - 1); }
+			pool_hash[slot] = p;
+		}
+	}
+
+	// in the style of deodhar.cpp:  "1 + 2.q + q^2".
+	void KLTable::sprint_polynomial(int p, string& s)
+	{
+		s = "";
+		if (get_degree(p) < 0) { s = "0";  return; }
+
+		int started = 0;
+		for (int k = 0; k <= get_degree(p); k++)
+		{
+			int c = get_coefficient(p, k);
+			if (c == 0) { continue; }
+			if (started == 1) { s = s + " + "; }
+
+			string monomial;
+			if (k == 0) { monomial = "1"; }
+			else if (k == 1) { monomial = "q"; }
+			else
+			{
+				stringstream m;
+				m << k;
+				monomial = "q^" + m.str();
+			}
+
+			if (c == 1) { s = s + monomial; }
+			else
+			{
+				stringstream m;
+				m << c;
+				s = s + m.str() + "." + monomial;
+			}
+			started = 1;
+		}
+	}
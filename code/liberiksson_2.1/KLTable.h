@@ -0,0 +1,65 @@
+#ifndef KLTABLE_H
+#define KLTABLE_H
+
+#include "BruhatInterval.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is a table of the Kazhdan-Lusztig polynomials P_{x,y} for all
+// pairs x <= y in a lower Bruhat interval [e, w] (take w to be the 
+// longest element for the whole group).  Elements are referred to by
+// their numbers in the BruhatInterval.  The polynomials are computed
+// by the usual recursion, from C'_y = C'_v C'_s - sum mu(z,v) C'_z 
+// where y = v s > v:
+//
+//   P_{x,y} = P_{xs,v} + q P_{x,v} - sum_{z s < z} mu(z,v) q^{(l(y)-l(z))/2} P_{x,z}.
+//
+// Since P_{x,y} = P_{xs,y} whenever s is a right descent of y, only 
+// the x with D_R(y) contained in D_R(x) are stored.  Each stored pair
+// holds a number into a pool of distinct polynomials, as most 
+// polynomials repeat many times (F4 has 1152 elements and only a few
+// dozen distinct polynomials).
+//
+//////////////////////////////////////////////////////////////////////
+
+class KLTable
+{
+	public:
+		BruhatInterval* interval;  // interval is not allocated in this class.
+		int size;
+		int count;
+
+		// row y:  the extremal x <= y in increasing order, with their polynomials.
+		vector<long long> row_start;  // count+1 entries.
+		vector<int> row_x;
+		vector<int> row_polynomial;
+
+		// the z < y with mu(z,y) != 0.
+		vector<long long> mu_start;  // count+1 entries.
+		vector<int> mu_z;
+		vector<int> mu_value;
+
+		// the polynomial pool:  polynomial p has coefficients pool_coefficients[pool_start[p]], ..., [pool_start[p+1]-1].
+		// polynomial 0 is zero, and polynomial 1 is 1.
+		vector<int> pool_start;
+		vector<int> pool_coefficients;
+		vector<int> pool_hash;  // open addressing:  polynomial numbers, or -1.
+
+		KLTable::KLTable(BruhatInterval* bi);
+
+		int KLTable::get_polynomial(int x, int y);  // the pool number of P_{x,y}, which is 0 unless x <= y.
+		int KLTable::get_mu(int x, int y);
+		int KLTable::get_degree(int p);  // -1 for the zero polynomial.
+		int KLTable::get_coefficient(int p, int k);
+		int KLTable::get_pool_size();
+		long long KLTable::get_stored_pairs();
+		void KLTable::sprint_polynomial(int p, string& s);
+
+		int KLTable::lift(int x, int y);  // multiply x up by the right descents of y until it is extremal, or -1 if this leaves the interval.
+		int KLTable::find_row(int x, int y);  // the pool number stored for extremal x in row y, or 0.
+		int KLTable::intern(int coefficients[], int degree);
+		unsigned long long KLTable::hash_polynomial(int coefficients[], int degree);
+		void KLTable::grow_pool_hash();
+};
+
+#endif
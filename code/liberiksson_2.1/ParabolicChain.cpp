@@ -0,0 +1,230 @@
+#include "ParabolicChain.h"
+
+#include <limits.h>
+
+
+	ParabolicChain::ParabolicChain(CoxeterSystem* cs)
+	{
+		coxeter_system = cs;
+		size = cs->size;
+
+		int* generator_order = new int[size];
+		for (int k = 0; k < size; k++) { generator_order[k] = k; }
+		build(generator_order);
+		delete[] generator_order;
+	}
+
+	ParabolicChain::ParabolicChain(CoxeterSystem* cs, int generator_order[])
+	{
+		coxeter_system = cs;
+		size = cs->size;
+		build(generator_order);
+	}
+
+	void ParabolicChain::build(int generator_order[])
+	{
+		order = new int[size];
+		position = new int[size];
+		for (int k = 0; k < size; k++)
+		{
+			order[k] = generator_order[k];
+			position[ order[k] ] = k;
+		}
+
+		cosets = new int[size];
+		radix = new long long[size+1];
+		transfer = new int*[size];
+		parent = new int*[size];
+		letter = new int*[size];
+		coset_length = new int*[size];
+
+		radix[0] = 1;
+		for (int k = 0; k < size; k++)
+		{
+			// breadth first search for X_{k+1}, so the representatives are listed by length and each parent comes first.
+			vector<CoxeterElement> reps;
+			vector<int> par;
+			vector<int> let;
+			vector<int> table;
+
+			CoxeterElement e = CoxeterElement(coxeter_system);
+			reps.push_back(e);
+			par.push_back(-1);
+			let.push_back(-1);
+
+			for (int x = 0; x < reps.size(); x++)
+			{
+				for (int s = 0; s < size; s++)
+				{
+					if (position[s] > k) { table.push_back(0); continue; }  // not a generator of this level.
+
+					CoxeterElement y = reps[x];
+					y.right_multiply(s);
+
+					int found = -1;
+					for (int i = 0; i < reps.size(); i++)
+					{
+						if (y.equals(&(reps[i])) == 1) { found = i; break; }
+					}
+
+					// Deodhar's lemma:  otherwise x s = t x for a generator t of the previous level, or x s is new.
+					int carry = -1;
+					if (found < 0)
+					{
+						for (int j = 0; j < k; j++)
+						{
+							CoxeterElement z = reps[x];
+							z.left_multiply(order[j]);
+							if (z.equals(&y) == 1) { carry = order[j]; break; }
+						}
+					}
+
+					if (found < 0 && carry < 0)
+					{
+						found = reps.size();
+						reps.push_back(y);
+						par.push_back(x);
+						let.push_back(s);
+					}
+
+					if (found >= 0) { table.push_back(found); }
+					else { table.push_back(0 - (carry+1)); }
+				}
+
+				if (reps.size() > PARABOLIC_CHAIN_MAX_COSETS)
+				{
+					cout << "ERROR:  parabolic subgroup chain has too many cosets (is the group infinite?)." << endl;
+					break;
+				}
+			}
+
+			cosets[k] = reps.size();
+			radix[k+1] = (radix[k] > LLONG_MAX / cosets[k]) ? 0 : radix[k] * cosets[k];  // 0 once the order overflows.
+
+			transfer[k] = new int[size * cosets[k]];
+			parent[k] = new int[cosets[k]];
+			letter[k] = new int[cosets[k]];
+			coset_length[k] = new int[cosets[k]];
+			for (int x = 0; x < cosets[k]; x++)
+			{
+				for (int s = 0; s < size; s++) { transfer[k][(size * x) + s] = table[(size * x) + s]; }
+				parent[k][x] = par[x];
+				letter[k][x] = let[x];
+				coset_length[k][x] = reps[x].length;
+			}
+		}
+	}
+
+	ParabolicChain::~ParabolicChain()
+	{
+		for (int k = 0; k < size; k++)
+		{
+			delete[] transfer[k];
+			delete[] parent[k];
+			delete[] letter[k];
+			delete[] coset_length[k];
+		}
+		delete[] transfer;
+		delete[] parent;
+		delete[] letter;
+		delete[] coset_length;
+		delete[] cosets;
+		delete[] radix;
+		delete[] order;
+		delete[] position;
+	}
+
+	long long ParabolicChain::get_order()
+	{
+		return radix[size];
+	}
+
+	void ParabolicChain::get_digits(long long r, int digits[])
+	{
+		for (int k = 0; k < size; k++)
+		{
+			digits[k] = (int) (r % cosets[k]);
+			r = r / cosets[k];
+		}
+	}
+
+	long long ParabolicChain::get_index(int digits[])
+	{
+		long long r = 0;
+		for (int k = 0; k < size; k++) { r += radix[k] * digits[k]; }
+		return r;
+	}
+
+	// w = x_1 ... x_n, so s acts on the last factor first, and a generator t of W_{k-1} passes down to x_{k-1}.
+	int ParabolicChain::find_transfer(int digits[], int s, int& new_digit)
+	{
+		for (int k = size-1; k > 0; k--)
+		{
+			int v = transfer[k][(size * digits[k]) + s];
+			if (v >= 0) { new_digit = v; return k; }
+			s = 0 - (v+1);
+		}
+		new_digit = transfer[0][(size * digits[0]) + s];
+		return 0;
+	}
+
+	void ParabolicChain::right_multiply_digits(int digits[], int s)
+	{
+		int new_digit = 0;
+		int k = find_transfer(digits, s, new_digit);
+		digits[k] = new_digit;
+	}
+
+	long long ParabolicChain::right_multiply(long long r, int s)
+	{
+		int* digits = new int[size];
+		get_digits(r, digits);
+		right_multiply_digits(digits, s);
+		long long rv = get_index(digits);
+		delete[] digits;
+		return rv;
+	}
+
+	long long ParabolicChain::rank(CoxeterElement& w)
+	{
+		int* reduced = new int[w.length];
+		w.get_reduced_expression(reduced);
+
+		int* digits = new int[size];
+		for (int k = 0; k < size; k++) { digits[k] = 0; }
+		for (int i = 0; i < w.length; i++) { right_multiply_digits(digits, reduced[i]); }
+
+		long long r = get_index(digits);
+		delete[] digits;
+		delete[] reduced;
+		return r;
+	}
+
+	int ParabolicChain::get_coset_word(int k, int x, int word[])
+	{
+		int len = coset_length[k][x];
+		for (int i = len-1; i >= 0; i--)
+		{
+			word[i] = letter[k][x];
+			x = parent[k][x];
+		}
+		return len;
+	}
+
+	CoxeterElement ParabolicChain::unrank(long long r)
+	{
+		int* digits = new int[size];
+		get_digits(r, digits);
+
+		CoxeterElement w = CoxeterElement(coxeter_system);
+		for (int k = 0; k < size; k++)
+		{
+			int* word = new int[ coset_length[k][digits[k]] ];
+			int len = get_coset_word(k, digits[k], word);
+			for (int i = 0; i < len; i++) { w.right_multiply(word[i]); }
+			delete[] word;
+		}
+
+		delete[] digits;
+		return w;
+	}
@@ -0,0 +1,58 @@
+#ifndef PARABOLICCHAIN_H
+#define PARABOLICCHAIN_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This factors a finite Coxeter group along the chain of parabolic
+// subgroups W_0 < W_1 < ... < W_n = W, where W_k is generated by the
+// first k generators in a given order (by default 0, 1, ..., n-1, so
+// that for example E8 > E7 > E6 > A5 > ... with the labels used here).  Every w factors uniquely (with lengths adding) 
+// as w = x_1 x_2 ... x_n, where x_k is a minimal length representative 
+// of a coset W_{k-1} x_k in W_k.  The index of w is the mixed-radix 
+// number with digits (index of x_1, ..., index of x_n).
+//
+// For each level k we store the coset representatives X_k and a
+// transfer table, using Deodhar's lemma:  if x is in X_k and s is a
+// generator of W_k, then either x s is in X_k, or x s = t x for some
+// generator t of W_{k-1}.  So right multiplication by s changes one
+// digit, after passing a generator down through some of the levels.
+//
+//////////////////////////////////////////////////////////////////////
+
+const int PARABOLIC_CHAIN_MAX_COSETS = 1 << 20;  // stop (with an error) on groups that are too large or infinite.
+
+class ParabolicChain
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		int size;
+		int* order;  // W_k is generated by order[0], ..., order[k-1].
+		int* position;  // position[order[k]] = k.
+
+		int* cosets;  // cosets[k] = |X_{k+1}|, the number of coset representatives at level k (0-based).
+		long long* radix;  // radix[k] = product of cosets[j] for j < k, or 0 if that does not fit in a long long.
+		int** transfer;  // transfer[k][size*x + s] = index of x s in X_{k+1}, or -(t+1) if x s = t x.
+		int** parent;  // parent[k][x] and letter[k][x] give x = parent * letter, with parent[k][0] = -1.
+		int** letter;
+		int** coset_length;  // coset_length[k][x] = length of the coset representative x.
+
+		ParabolicChain::ParabolicChain(CoxeterSystem* cs);
+		ParabolicChain::ParabolicChain(CoxeterSystem* cs, int generator_order[]);
+		ParabolicChain::~ParabolicChain();
+
+		long long ParabolicChain::get_order();
+		long long ParabolicChain::rank(CoxeterElement& w);
+		CoxeterElement ParabolicChain::unrank(long long r);
+		long long ParabolicChain::right_multiply(long long r, int s);  // index of w s, where w has index r.
+
+		void ParabolicChain::get_digits(long long r, int digits[]);
+		long long ParabolicChain::get_index(int digits[]);
+		void ParabolicChain::right_multiply_digits(int digits[], int s);
+		int ParabolicChain::find_transfer(int digits[], int s, int& new_digit);  // the level whose digit changes when multiplying by s on the right.
+		void ParabolicChain::build(int generator_order[]);
+		int ParabolicChain::get_coset_word(int k, int x, int word[]);  // writes a reduced word for x at level k, and returns its length.
+};
+
+#endif
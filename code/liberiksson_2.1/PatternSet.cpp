@@ -0,0 +1,147 @@
+#include "PatternSet.h"
+
+#include <fstream>
+
+
+	PatternSet::PatternSet()
+	{
+		children.resize(1);
+		ends.push_back(-1);
+		shortest.push_back(-1);  // no patterns yet.
+	}
+
+	PatternSet::~PatternSet()
+	{
+	}
+
+	int PatternSet::add(int one_line[], int k)
+	{
+		if (k < 1) { return -1; }
+
+		// the absolute values must be 1, ..., k.
+		vector<int> seen(k+1, 0);
+		for (int i = 0; i < k; i++)
+		{
+			int a = abs(one_line[i]);
+			if (a < 1 || a > k || seen[a] == 1) { return -1; }
+			seen[a] = 1;
+		}
+
+		int node = 0;
+		for (int j = 0; j < k; j++)
+		{
+			if (shortest[node] < 0 || shortest[node] > k-j) { shortest[node] = k-j; }
+
+			int r = 0;
+			for (int i = 0; i < j; i++) { if (abs(one_line[i]) < abs(one_line[j])) { r++; } }
+			int label = (one_line[j] < 0) ? -(r+1) : (r+1);
+
+			map<int,int>::iterator iter = children[node].find(label);
+			if (iter != children[node].end()) { node = (*iter).second;  continue; }
+
+			int child = children.size();
+			children.push_back(map<int,int>());
+			ends.push_back(-1);
+			shortest.push_back(-1);
+			children[node][label] = child;
+			node = child;
+		}
+
+		shortest[node] = 0;
+		if (ends[node] >= 0) { return ends[node]; }  // already in the set.
+
+		ends[node] = patterns.size();
+		patterns.push_back(vector<int>(one_line, one_line + k));
+		return ends[node];
+	}
+
+	int PatternSet::add(CoxeterElement& pattern)
+	{
+		return add(pattern.one_line, pattern.size);
+	}
+
+	int PatternSet::load(string filename)
+	{
+		ifstream in(filename.c_str());
+		if (!in) { cout << "ERROR:  cannot read patterns from " << filename << "." << endl;  return -1; }
+
+		int count = 0;
+		string line;
+		while (getline(in, line))
+		{
+			if (line.size() == 0 || line[0] == '#') { continue; }
+
+			istringstream entries(line);
+			vector<int> p;
+			int e;
+			while (entries >> e) { p.push_back(e); }
+			if (p.size() == 0) { continue; }
+
+			if (add(&p[0], p.size()) < 0) { cout << "ERROR:  " << line << " is not a signed permutation." << endl;  return -1; }
+			count++;
+		}
+		return count;
+	}
+
+	int PatternSet::size()
+	{
+		return patterns.size();
+	}
+
+	int PatternSet::find(int one_line[], int n)
+	{
+		if (shortest[0] < 0 || shortest[0] > n) { return -1; }
+
+		int* chosen = new int[ shortest.size() ];  // the absolute values of the entries picked so far (at most the depth of the trie).
+		int found = search(one_line, n, 0, 0, 0, chosen);
+		delete[] chosen;
+		return found;
+	}
+
+	int PatternSet::find(CoxeterElement& w)
+	{
+		if (w.coxeter_system->track_one_line == 0) { return -1; }
+		return find(w.one_line, w.size);
+	}
+
+	int PatternSet::contains(CoxeterElement& w)
+	{
+		return (find(w) >= 0) ? 1 : 0;
+	}
+
+	// extends the subsequence chosen[0], ..., chosen[depth-1] (which reaches node) by entries at positions start, ..., n-1.
+	int PatternSet::search(int one_line[], int n, int node, int start, int depth, int chosen[])
+	{
+		for (int t = start; n - t >= shortest[node]; t++)
+		{
+			int a = abs(one_line[t]);
+			int r = 0;
+			for (int i = 0; i < depth; i++) { if (chosen[i] < a) { r++; } }
+			int label = (one_line[t] < 0) ? -(r+1) : (r+1);
+
+			map<int,int>::iterator iter = children[node].find(label);
+			if (iter == children[node].end()) { continue; }
+
+			int child = (*iter).second;
+			if (ends[child] >= 0)
+			{
+				if (DEBUG_VERBOSE) { cout << " (one_line pattern match on pattern " << ends[child] << ") " << endl; }
+				return ends[child];
+			}
+
+			chosen[depth] = a;
+			int found = search(one_line, n, child, t+1, depth+1, chosen);
+			if (found >= 0) { return found; }
+		}
+		return -1;
+	}
+
+	void PatternSet::print()
+	{
+		for (int p = 0; p < patterns.size(); p++)
+		{
+			cout << "  ";
+			for (int i = 0; i < patterns[p].size(); i++) { cout << patterns[p][i] << " "; }
+			cout << endl;
+		}
+	}
@@ -0,0 +1,55 @@
+#ifndef PATTERNSET_H
+#define PATTERNSET_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is a list of signed one-line patterns (of any sizes), compiled
+// into a trie so that w can be tested against all of them in a single
+// pass over the subsequences of its one-line notation.  As in
+// CoxeterElement::contains_one_line_pattern, w contains a pattern p of
+// size k if some k entries of w (in order) have the same signs as p
+// and flatten to the absolute values of p.
+//
+// A node of the trie at depth j stands for a flattened prefix of size
+// j, and its children are labeled by where the next entry falls among
+// the absolute values of the prefix, and its sign:  +(r+1) or -(r+1)
+// if it is larger than exactly r of them.  The search only extends a
+// subsequence of w along the edges of the trie, and stops extending
+// once too few entries of w remain to finish the shortest pattern
+// below the node.
+//
+// The patterns may be read from a file holding one pattern per line,
+// e.g. "-1 6 7 8 -5 2 3 4" (lines starting with # are skipped).
+//
+//////////////////////////////////////////////////////////////////////
+
+class PatternSet
+{
+	public:
+		vector< vector<int> > patterns;
+
+		// the trie, with the root at node 0.
+		vector< map<int,int> > children;
+		vector<int> ends;  // the number of the pattern ending at each node, or -1.
+		vector<int> shortest;  // the fewest entries needed below each node to finish a pattern.
+
+		PatternSet::PatternSet();
+		PatternSet::~PatternSet();
+
+		int PatternSet::add(int one_line[], int k);  // returns the number of the pattern, or -1 if it is not a signed permutation.
+		int PatternSet::add(CoxeterElement& pattern);  // the first pattern.size entries of its one_line.
+		int PatternSet::load(string filename);  // returns the number of patterns read, or -1 on error.
+		int PatternSet::size();
+
+		int PatternSet::find(int one_line[], int n);  // the number of a pattern contained in one_line[0], ..., one_line[n-1], or -1.
+		int PatternSet::find(CoxeterElement& w);
+		int PatternSet::contains(CoxeterElement& w);  // 1 if w contains any of the patterns.
+
+		void PatternSet::print();
+
+		int PatternSet::search(int one_line[], int n, int node, int start, int depth, int chosen[]);
+};
+
+#endif
@@ -0,0 +1,118 @@
+#include "RootElement.h"
+
+
+	// construct identity element
+	RootElement::RootElement(RootSystem* rs)
+	{
+		root_system = rs;
+		size = rs->size;
+		words = rs->words;
+		inversions = new unsigned long long[words];
+		scratch = new unsigned long long[words];
+		for (int w = 0; w < words; w++) { inversions[w] = 0; }
+	}
+
+	// construct element with given reduced word
+	RootElement::RootElement(RootSystem* rs, int red[], int len)
+	{
+		root_system = rs;
+		size = rs->size;
+		words = rs->words;
+		inversions = new unsigned long long[words];
+		scratch = new unsigned long long[words];
+		for (int w = 0; w < words; w++) { inversions[w] = 0; }
+
+		for (int i = 0; i < len; i++) { right_multiply(red[i]); }
+	}
+
+	RootElement::RootElement(const RootElement& cp)
+	{
+		root_system = cp.root_system;
+		size = cp.size;
+		words = cp.words;
+		inversions = new unsigned long long[words];
+		scratch = new unsigned long long[words];
+		for (int w = 0; w < words; w++) { inversions[w] = cp.inversions[w]; }
+	}
+
+	RootElement::~RootElement()
+	{
+		delete[] inversions;
+		delete[] scratch;
+	}
+
+	int RootElement::equals(RootElement* e)
+	{
+		for (int w = 0; w < words; w++)
+		{
+			if (e->inversions[w] != inversions[w]) { return 0; }
+		}
+		return 1;
+	}
+
+	void RootElement::right_multiply(int s)
+	{
+		int had_s = has_right_descent(s);
+
+		for (int w = 0; w < words; w++) { scratch[w] = 0; }
+
+		int chunks = root_system->chunks;
+		unsigned long long* table = root_system->chunk_action + ((s * chunks) * 256 * words);
+		for (int c = 0; c < chunks; c++)
+		{
+			int v = (int) ((inversions[c / 8] >> (8 * (c % 8))) & 255);
+			if (v == 0) { continue; }
+
+			unsigned long long* image = table + (((c * 256) + v) * words);
+			for (int w = 0; w < words; w++) { scratch[w] |= image[w]; }
+		}
+
+		// the simple root a_s is root s, and s(a_s) is negative so it was dropped above.
+		if (had_s == 0) { scratch[s / 64] |= (1ULL << (s % 64)); }
+
+		for (int w = 0; w < words; w++) { inversions[w] = scratch[w]; }
+	}
+
+	int RootElement::has_right_descent(int s)
+	{
+		return (int) ((inversions[s / 64] >> (s % 64)) & 1);
+	}
+
+	int RootElement::has_inversion(int k)
+	{
+		return (int) ((inversions[k / 64] >> (k % 64)) & 1);
+	}
+
+	int RootElement::get_length()
+	{
+		int length = 0;
+		for (int w = 0; w < words; w++) { length += __builtin_popcountll(inversions[w]); }
+		return length;
+	}
+
+	// strip off right descents, which reads a reduced word backwards.
+	void RootElement::get_reduced_expression(int reduced[])
+	{
+		RootElement v = RootElement(*this);
+		int i = v.get_length() - 1;
+		while (i >= 0)
+		{
+			for (int s = 0; s < size; s++)
+			{
+				if (v.has_right_descent(s)) { reduced[i] = s;  v.right_multiply(s);  i--;  break; }
+			}
+		}
+	}
+
+	void RootElement::print_reduced_expression()
+	{
+		int length = get_length();
+		int* reduced = new int[length];
+		get_reduced_expression(reduced);
+
+		cout << "( ";
+		for (int i = 0; i < length; i++) { cout << reduced[i] << " "; }
+		cout << ")";
+
+		delete[] reduced;
+	}
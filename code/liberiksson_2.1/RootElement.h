@@ -0,0 +1,45 @@
+#ifndef ROOTELEMENT_H
+#define ROOTELEMENT_H
+
+#include "RootSystem.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This represents an element w of a finite Coxeter group by its 
+// (right) inversion set N(w) = { b > 0 : w(b) < 0 }, stored as a bitset
+// over the positive roots of a RootSystem.  
+//
+// Then the length of w is the size of N(w), s is a right descent iff 
+// a_s is in N(w), and for a reflection t with root b, w t < w iff b is 
+// in N(w).  Right multiplication uses
+//   N(w s) = s( N(w) - {a_s} ) if a_s is in N(w), and
+//   N(w s) = s( N(w) ) + {a_s} otherwise,
+// where s acts on the bitset one byte at a time.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+class RootElement
+{
+	public:
+		RootSystem* root_system;  // root_system is not allocated in this class.
+		int size;
+		int words;
+		unsigned long long* inversions;  // bit k is set if root k is in N(w).
+		unsigned long long* scratch;
+
+		RootElement::RootElement(RootSystem* rs);  // construct identity element.
+		RootElement::RootElement(RootSystem* rs, int red[], int len);  // construct element with given reduced word.
+		RootElement::RootElement(const RootElement& cp);
+		RootElement::~RootElement();
+
+		int RootElement::equals(RootElement* e);
+		void RootElement::right_multiply(int s);
+		int RootElement::has_right_descent(int s);
+		int RootElement::has_inversion(int k);  // 1 if w t < w, where t is the reflection of root k.
+		int RootElement::get_length();
+		void RootElement::get_reduced_expression(int reduced[]);  // requires an array of length at least get_length().
+		void RootElement::print_reduced_expression();
+};
+
+#endif
@@ -0,0 +1,150 @@
+#include "RootSystem.h"
+
+
+	RootSystem::RootSystem(CoxeterSystem* cs)
+	{
+		coxeter_system = cs;
+		size = cs->size;
+
+		cartan = new int[size * size];
+		for (int i = 0; i < size*size; i++) { cartan[i] = 0; }
+		for (int i = 0; i < size; i++)
+		{
+			cartan[(size * i) + i] = 2;
+			for (int k = 0; k < coxeter_system->get_degree(i); k++)
+			{
+				int j = coxeter_system->get_neighbor(i,k);
+				cartan[(size * i) + j] = 0 - coxeter_system->get_amplitude(i,k);
+			}
+		}
+
+		// breadth first search from the simple roots:  s_i permutes the positive roots other than a_i.
+		vector<int> found;
+		map< vector<int>, int > numbers;
+		for (int i = 0; i < size; i++)
+		{
+			vector<int> a(size, 0);
+			a[i] = 1;
+			numbers[a] = i;
+			found.insert(found.end(), a.begin(), a.end());
+		}
+
+		// the roots of H3, H4 and I2(m) do not have integer coordinates.
+		if (coxeter_system->is_quadratic()) { cout << "ERROR:  root systems with irrational coordinates are not supported." << endl; }
+
+		vector<int> table;
+		for (int k = 0; k < found.size() / size && !(coxeter_system->is_quadratic()); k++)
+		{
+			for (int i = 0; i < size; i++)
+			{
+				if (k == i) { table.push_back(-1); continue; }
+
+				// s_i(b) = b - <b, a_i^v> a_i
+				vector<int> b(found.begin() + (size * k), found.begin() + (size * (k+1)));
+				int pairing = 0;
+				for (int j = 0; j < size; j++) { pairing += b[j] * cartan[(size * j) + i]; }
+				b[i] = b[i] - pairing;
+
+				map< vector<int>, int >::iterator iter = numbers.find(b);
+				if (iter != numbers.end()) { table.push_back(iter->second); }
+				else
+				{
+					int n = found.size() / size;
+					numbers[b] = n;
+					found.insert(found.end(), b.begin(), b.end());
+					table.push_back(n);
+				}
+			}
+
+			if (found.size() / size > ROOT_SYSTEM_MAX_ROOTS)
+			{
+				cout << "ERROR:  too many positive roots (is the group infinite?)." << endl;
+				break;
+			}
+		}
+
+		root_count = table.size() / size;
+		words = (root_count + 63) / 64;
+		chunks = (root_count + 7) / 8;
+
+		roots = new int[size * root_count];
+		heights = new int[root_count];
+		action = new int[size * root_count];
+		for (int k = 0; k < root_count; k++)
+		{
+			heights[k] = 0;
+			for (int j = 0; j < size; j++)
+			{
+				roots[(size * k) + j] = found[(size * k) + j];
+				heights[k] += found[(size * k) + j];
+				action[(size * k) + j] = table[(size * k) + j];
+			}
+		}
+
+		build_chunk_action();
+	}
+
+	void RootSystem::build_chunk_action()
+	{
+		chunk_action = new unsigned long long[size * chunks * 256 * words];
+		for (int i = 0; i < size; i++)
+		{
+			for (int c = 0; c < chunks; c++)
+			{
+				for (int v = 0; v < 256; v++)
+				{
+					unsigned long long* image = chunk_action + (((((i * chunks) + c) * 256) + v) * words);
+					for (int w = 0; w < words; w++) { image[w] = 0; }
+
+					for (int b = 0; b < 8; b++)
+					{
+						int k = (8 * c) + b;
+						if (((v >> b) & 1) == 0 || k >= root_count) { continue; }
+
+						int target = action[(size * k) + i];
+						if (target >= 0) { image[target / 64] |= (1ULL << (target % 64)); }
+					}
+				}
+			}
+		}
+	}
+
+	RootSystem::~RootSystem()
+	{
+		delete[] cartan;
+		delete[] roots;
+		delete[] heights;
+		delete[] action;
+		delete[] chunk_action;
+	}
+
+	int RootSystem::get_root_count()
+	{
+		return root_count;
+	}
+
+	int RootSystem::reflect(int i, int k)
+	{
+		return action[(size * k) + i];
+	}
+
+	int RootSystem::find_root(int coordinates[])
+	{
+		for (int k = 0; k < root_count; k++)
+		{
+			int matches = 1;
+			for (int j = 0; j < size; j++)
+			{
+				if (roots[(size * k) + j] != coordinates[j]) { matches = 0; break; }
+			}
+			if (matches == 1) { return k; }
+		}
+		return -1;
+	}
+
+	void RootSystem::print_root(int k)
+	{
+		cout << "< ";
+		for (int j = 0; j < size; j++) { cout << roots[(size * k) + j] << " "; }
+		cout << ">";
+	}
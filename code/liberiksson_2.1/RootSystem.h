@@ -0,0 +1,52 @@
+#ifndef ROOTSYSTEM_H
+#define ROOTSYSTEM_H
+
+#include "CoxeterSystem.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is the set of positive roots of a finite Coxeter system, in
+// coordinates with respect to the simple roots.  The Cartan matrix
+// uses the same amplitudes as the numbers game (see 
+// CoxeterSystem::build_neighbors), so all coordinates are integers:  
+// s_i(a_j) = a_j + amplitude(j,i) a_i.
+//
+// The positive roots are numbered 0, ..., N-1 with the simple roots 
+// first (root i is a_i), and action[size*k + i] is the number of the
+// root s_i(root k), or -1 when k = i (since s_i(a_i) = -a_i).
+//
+// For RootElement, the action of each s_i on a set of positive roots
+// stored as a bitset is also precomputed one byte at a time:  
+// chunk_action gives, for each generator, byte position and byte value,
+// the bitset of the images of those roots.
+//
+//////////////////////////////////////////////////////////////////////
+
+const int ROOT_SYSTEM_MAX_ROOTS = 4096;  // stop (with an error) on infinite groups.
+
+class RootSystem
+{
+	public:
+		CoxeterSystem* coxeter_system;  // coxeter_system is not allocated in this class.
+		int size;
+		int root_count;  // N, the number of positive roots (= the number of reflections).
+		int words;  // number of 64 bit words in a bitset of positive roots.
+		int chunks;  // number of bytes in a bitset of positive roots.
+
+		int* roots;  // roots[size*k + j] = coordinate of a_j in root k.
+		int* heights;  // heights[k] = sum of the coordinates of root k.
+		int* action;  // action[size*k + i] = number of s_i(root k), or -1.
+		int* cartan;  // cartan[size*i + j] = <a_i, a_j^v>.
+		unsigned long long* chunk_action;  // the images of byte v at byte position c under s_i start at chunk_action[((((i * chunks) + c) * 256) + v) * words].
+
+		RootSystem::RootSystem(CoxeterSystem* cs);
+		RootSystem::~RootSystem();
+
+		int RootSystem::get_root_count();
+		int RootSystem::reflect(int i, int k);  // number of s_i(root k), or -1.
+		int RootSystem::find_root(int coordinates[]);  // number of the positive root with these coordinates, or -1.
+		void RootSystem::print_root(int k);
+		void RootSystem::build_chunk_action();
+};
+
+#endif
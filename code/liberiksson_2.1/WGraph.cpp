@@ -0,0 +1,246 @@
+#include "WGraph.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+// File layout:  magic, size, vertex_count, edge_count, then the ranks, left_descents, right_descents, 
+// edge_start, lengths, edge_target and edge_mu arrays.
+static const char WGRAPH_MAGIC[8] = { 'W', 'G', 'R', 'A', 'P', 'H', '1', 0 };
+
+struct WGraphHeader
+{
+	char magic[8];
+	long long size;
+	long long vertex_count;
+	long long edge_count;
+};
+
+struct RankOrder
+{
+	long long* keys;
+	bool operator()(long long a, long long b) const { return keys[a] < keys[b]; }
+};
+
+
+	WGraph::WGraph(int size)
+	{
+		this->size = size;
+		vertex_count = 0;
+		edge_count = 0;
+		ranks = NULL;
+		left_descents = NULL;
+		right_descents = NULL;
+		edge_start = NULL;
+		lengths = NULL;
+		edge_target = NULL;
+		edge_mu = NULL;
+		mapping = NULL;
+		mapping_size = 0;
+	}
+
+	WGraph::WGraph(const char* filename)
+	{
+		size = 0;
+		vertex_count = -1;
+		edge_count = 0;
+		ranks = NULL;
+		left_descents = NULL;
+		right_descents = NULL;
+		edge_start = NULL;
+		lengths = NULL;
+		edge_target = NULL;
+		edge_mu = NULL;
+		mapping = NULL;
+		mapping_size = 0;
+
+		int fd = open(filename, O_RDONLY);
+		if (fd < 0) { cout << "ERROR:  cannot read " << filename << "." << endl;  return; }
+
+		struct stat st;
+		if (fstat(fd, &st) != 0 || st.st_size < sizeof(WGraphHeader)) { close(fd);  cout << "ERROR:  " << filename << " is not a W-graph." << endl;  return; }
+
+		mapping_size = st.st_size;
+		void* m = mmap(NULL, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (m == MAP_FAILED) { mapping_size = 0;  return; }
+		mapping = (char*) m;
+
+		WGraphHeader* header = (WGraphHeader*) mapping;
+		long long n = header->vertex_count;
+		long long e = header->edge_count;
+		long long expected = sizeof(WGraphHeader) + (sizeof(long long) * n) + (2 * sizeof(unsigned long long) * n) 
+			+ (sizeof(long long) * (n+1)) + (sizeof(int) * n) + (2 * sizeof(int) * e);
+		if (memcmp(header->magic, WGRAPH_MAGIC, 8) != 0 || mapping_size != expected)
+		{
+			cout << "ERROR:  " << filename << " is not a W-graph." << endl;
+			munmap(mapping, mapping_size);
+			mapping = NULL;
+			mapping_size = 0;
+			return;
+		}
+
+		size = header->size;
+		vertex_count = n;
+		edge_count = e;
+		ranks = (long long*) (mapping + sizeof(WGraphHeader));
+		left_descents = (unsigned long long*) (ranks + n);
+		right_descents = left_descents + n;
+		edge_start = (long long*) (right_descents + n);
+		lengths = (int*) (edge_start + n + 1);
+		edge_target = lengths + n;
+		edge_mu = edge_target + e;
+	}
+
+	WGraph::~WGraph()
+	{
+		free_arrays();
+	}
+
+	void WGraph::free_arrays()
+	{
+		if (mapping != NULL) { munmap(mapping, mapping_size);  mapping = NULL; }
+		else
+		{
+			if (ranks != NULL) { delete[] ranks; }
+			if (left_descents != NULL) { delete[] left_descents; }
+			if (right_descents != NULL) { delete[] right_descents; }
+			if (edge_start != NULL) { delete[] edge_start; }
+			if (lengths != NULL) { delete[] lengths; }
+			if (edge_target != NULL) { delete[] edge_target; }
+			if (edge_mu != NULL) { delete[] edge_mu; }
+		}
+		ranks = NULL;
+		left_descents = NULL;
+		right_descents = NULL;
+		edge_start = NULL;
+		lengths = NULL;
+		edge_target = NULL;
+		edge_mu = NULL;
+	}
+
+	void WGraph::add_vertex(CoxeterElement& w, long long rank)
+	{
+		unsigned long long right = 0;
+		for (int s = 0; s < w.size; s++) { if (w.word[s] < 0) { right |= (1ULL << s); } }
+
+		CoxeterElement inverse(w);
+		inverse.invert();
+		unsigned long long left = 0;
+		for (int s = 0; s < w.size; s++) { if (inverse.word[s] < 0) { left |= (1ULL << s); } }
+
+		new_ranks.push_back(rank);
+		new_lengths.push_back(w.length);
+		new_left_descents.push_back(left);
+		new_right_descents.push_back(right);
+	}
+
+	void WGraph::add_edge(long long x_rank, long long y_rank, int mu)
+	{
+		new_edges.push_back(x_rank);
+		new_edges.push_back(y_rank);
+		new_mu.push_back(mu);
+	}
+
+	long long WGraph::find_vertex(long long rank)
+	{
+		long long low = 0;
+		long long high = vertex_count - 1;
+		while (low <= high)
+		{
+			long long mid = (low + high) / 2;
+			if (ranks[mid] == rank) { return mid; }
+			if (ranks[mid] < rank) { low = mid + 1; }
+			else { high = mid - 1; }
+		}
+		return -1;
+	}
+
+	// sort the vertices by rank, and collect the edges of each vertex.
+	void WGraph::build()
+	{
+		free_arrays();
+
+		long long n = new_ranks.size();
+		vector<long long> order(n);
+		for (long long i = 0; i < n; i++) { order[i] = i; }
+		RankOrder by_rank;
+		by_rank.keys = (n > 0) ? &(new_ranks[0]) : NULL;
+		sort(order.begin(), order.end(), by_rank);
+
+		vertex_count = n;
+		ranks = new long long[n];
+		lengths = new int[n];
+		left_descents = new unsigned long long[n];
+		right_descents = new unsigned long long[n];
+		for (long long i = 0; i < n; i++)
+		{
+			ranks[i] = new_ranks[ order[i] ];
+			lengths[i] = new_lengths[ order[i] ];
+			left_descents[i] = new_left_descents[ order[i] ];
+			right_descents[i] = new_right_descents[ order[i] ];
+		}
+
+		// (vertex, neighbor, mu) triples, one for each direction of each edge.
+		vector< pair<long long, pair<int, int> > > entries;
+		for (long long k = 0; k < new_mu.size(); k++)
+		{
+			long long x = find_vertex(new_edges[2*k]);
+			long long y = find_vertex(new_edges[(2*k) + 1]);
+			if (x < 0 || y < 0 || new_mu[k] == 0) { continue; }
+			entries.push_back(make_pair(x, make_pair((int) y, new_mu[k])));
+			entries.push_back(make_pair(y, make_pair((int) x, new_mu[k])));
+		}
+		sort(entries.begin(), entries.end());
+
+		edge_count = entries.size();
+		edge_start = new long long[n+1];
+		edge_target = new int[edge_count + 1];
+		edge_mu = new int[edge_count + 1];
+		long long e = 0;
+		for (long long i = 0; i < n; i++)
+		{
+			edge_start[i] = e;
+			while (e < edge_count && entries[e].first == i)
+			{
+				edge_target[e] = entries[e].second.first;
+				edge_mu[e] = entries[e].second.second;
+				e++;
+			}
+		}
+		edge_start[n] = e;
+
+		new_ranks.clear();
+		new_lengths.clear();
+		new_left_descents.clear();
+		new_right_descents.clear();
+		new_edges.clear();
+		new_mu.clear();
+	}
+
+	int WGraph::save(const char* filename)
+	{
+		ofstream out(filename, ios::out | ios::binary);
+		if (!out) { cout << "ERROR:  cannot write " << filename << "." << endl;  return 0; }
+
+		WGraphHeader header;
+		memcpy(header.magic, WGRAPH_MAGIC, 8);
+		header.size = size;
+		header.vertex_count = vertex_count;
+		header.edge_count = edge_count;
+
+		out.write((char*) &header, sizeof(WGraphHeader));
+		out.write((char*) ranks, sizeof(long long) * vertex_count);
+		out.write((char*) left_descents, sizeof(unsigned long long) * vertex_count);
+		out.write((char*) right_descents, sizeof(unsigned long long) * vertex_count);
+		out.write((char*) edge_start, sizeof(long long) * (vertex_count + 1));
+		out.write((char*) lengths, sizeof(int) * vertex_count);
+		out.write((char*) edge_target, sizeof(int) * edge_count);
+		out.write((char*) edge_mu, sizeof(int) * edge_count);
+		out.close();
+		return 1;
+	}
@@ -0,0 +1,65 @@
+#ifndef WGRAPH_H
+#define WGRAPH_H
+
+#include "CoxeterElement.h"
+
+//////////////////////////////////////////////////////////////////////
+//
+// This is a W-graph on a set of elements of a finite Coxeter group:
+// the vertices are elements (stored by their ElementIndex ranks, in 
+// increasing order) together with their lengths and left and right 
+// descent sets as bitmasks, and there is an edge between x and y with
+// weight mu(x,y) whenever this mu-coefficient is nonzero.
+//
+// The edges are stored in compressed sparse row form:  the neighbors
+// of vertex i are edge_target[edge_start[i]], ..., 
+// edge_target[edge_start[i+1]-1] (in increasing order), with weights 
+// edge_mu[...].  Each edge appears once from each of its endpoints.
+//
+// A graph is built with add_vertex() and add_edge() followed by 
+// build(), and can be saved to a binary file and mapped back (with 
+// mmap) by the cells program.  Edges are only kept if both of their 
+// endpoints are vertices.
+//
+//////////////////////////////////////////////////////////////////////
+
+class WGraph
+{
+	public:
+		int size;
+		long long vertex_count;
+		long long edge_count;  // counting each edge twice.
+
+		long long* ranks;
+		unsigned long long* left_descents;
+		unsigned long long* right_descents;
+		long long* edge_start;  // vertex_count+1 entries.
+		int* lengths;
+		int* edge_target;
+		int* edge_mu;
+
+		char* mapping;  // the mmapped file, or NULL if the graph was built in memory.
+		long long mapping_size;
+
+		// input to build().
+		vector<long long> new_ranks;
+		vector<int> new_lengths;
+		vector<unsigned long long> new_left_descents;
+		vector<unsigned long long> new_right_descents;
+		vector<long long> new_edges;  // pairs of ranks.
+		vector<int> new_mu;
+
+		WGraph::WGraph(int size);  // an empty graph.
+		WGraph::WGraph(const char* filename);  // map a graph written by save().  vertex_count is -1 if this fails.
+		WGraph::~WGraph();
+
+		void WGraph::add_vertex(CoxeterElement& w, long long rank);
+		void WGraph::add_edge(long long x_rank, long long y_rank, int mu);
+		void WGraph::build();
+		int WGraph::save(const char* filename);  // returns 1 on success.
+
+		long long WGraph::find_vertex(long long rank);  // the vertex with this rank, or -1.
+		void WGraph::free_arrays();
+};
+
+#endif
@@ -0,0 +1,183 @@
+#include "CoxeterElement.h"
+#include "CoxeterRegistry.h"
+#include "ElementIndex.h"
+#include "WGraph.h"
+
+/////////////////////////////////////////////////////////////////////
+//
+//  This is code which computes the Kazhdan-Lusztig left, right and
+//  two-sided cells of a W-graph written by "verify -wgraph".
+//
+//  An edge x -- y with L(x) not contained in L(y) gives x <=_L y, so 
+//  the left cells are the strongly connected components of the 
+//  directed graph with these arcs (and similarly for right cells 
+//  with right descents, and two-sided cells with both).  The 
+//  components are found with an iterative version of Tarjan's 
+//  algorithm.
+//
+//  Only the vertices of the W-graph are used, so when these are not
+//  the whole group, the cells are those of the induced subgraph.
+//
+/////////////////////////////////////////////////////////////////////
+
+static const int LEFT = 1;
+static const int RIGHT = 2;
+
+// the arc i -> j, for an edge between i and j, is used if the descent set of j is not contained in that of i.
+int has_arc(WGraph& g, long long i, int j, int sides)
+{
+	if ((sides & LEFT) && (g.left_descents[j] & ~(g.left_descents[i])) != 0) { return 1; }
+	if ((sides & RIGHT) && (g.right_descents[j] & ~(g.right_descents[i])) != 0) { return 1; }
+	return 0;
+}
+
+// sets component[i] to the number of the strongly connected component containing vertex i, and returns the number of components.
+long long strong_components(WGraph& g, int sides, vector<long long>& component)
+{
+	long long n = g.vertex_count;
+	vector<long long> number(n, -1);
+	vector<long long> low(n, 0);
+	vector<char> on_stack(n, 0);
+	vector<long long> stack;
+	vector<long long> call_vertex;  // the depth-first search path, with the next edge to try from each vertex.
+	vector<long long> call_edge;
+	component.assign(n, -1);
+
+	long long next_number = 0;
+	long long components = 0;
+	for (long long root = 0; root < n; root++)
+	{
+		if (number[root] >= 0) { continue; }
+
+		number[root] = low[root] = next_number++;
+		stack.push_back(root);
+		on_stack[root] = 1;
+		call_vertex.push_back(root);
+		call_edge.push_back(g.edge_start[root]);
+
+		while (!call_vertex.empty())
+		{
+			long long v = call_vertex.back();
+			long long& e = call_edge.back();
+
+			if (e < g.edge_start[v+1])
+			{
+				int u = g.edge_target[e];
+				e++;
+				if (!has_arc(g, v, u, sides)) { continue; }
+
+				if (number[u] < 0)
+				{
+					number[u] = low[u] = next_number++;
+					stack.push_back(u);
+					on_stack[u] = 1;
+					call_vertex.push_back(u);
+					call_edge.push_back(g.edge_start[u]);
+				}
+				else if (on_stack[u] && number[u] < low[v]) { low[v] = number[u]; }
+				continue;
+			}
+
+			// v is finished:  pop its component if it is a root, and pass low[v] back to its parent.
+			if (low[v] == number[v])
+			{
+				long long u;
+				do
+				{
+					u = stack.back();
+					stack.pop_back();
+					on_stack[u] = 0;
+					component[u] = components;
+				} while (u != v);
+				components++;
+			}
+
+			call_vertex.pop_back();
+			call_edge.pop_back();
+			if (!call_vertex.empty())
+			{
+				long long parent = call_vertex.back();
+				if (low[v] < low[parent]) { low[parent] = low[v]; }
+			}
+		}
+	}
+	return components;
+}
+
+void print_cells(WGraph& g, ElementIndex& index, string kind, int sides, int list_cells)
+{
+	vector<long long> component;
+	long long count = strong_components(g, sides, component);
+
+	// the size of each cell, and its representative:  the shortest element (of smallest rank).
+	vector<long long> cell_size(count, 0);
+	vector<long long> representative(count, -1);
+	for (long long i = 0; i < g.vertex_count; i++)
+	{
+		long long c = component[i];
+		cell_size[c]++;
+		if (representative[c] < 0 || g.lengths[i] < g.lengths[ representative[c] ]) { representative[c] = i; }
+	}
+
+	map<long long, long long> by_size;
+	for (long long c = 0; c < count; c++) { by_size[ cell_size[c] ]++; }
+
+	cout << kind << " cells:  " << count << " cells." << endl;
+	cout << "Number of cells of each size: " << endl;
+	for (map<long long, long long>::iterator iter = by_size.begin(); iter != by_size.end(); iter++)
+	{ cout << "  " << (*iter).first << ":  " << (*iter).second << endl; }
+
+	if (list_cells == 1)
+	{
+		for (long long c = 0; c < count; c++)
+		{
+			CoxeterElement w = index.unrank(g.ranks[ representative[c] ]);
+			string name;
+			w.sprint_reduced_expression(name);
+			cout << "  cell " << c << " of size " << cell_size[c] << ", containing " << name << endl;
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////
+// Input:  Coxeter matrix (type), W-graph file, -list (optional)
+// Output:  the number and sizes of the left, right and two-sided cells.
+/////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3) { 
+		cout << "No arguments given." << endl;  
+                cout << "Usage:  ./cells D8 D8.wg" << endl;
+                cout << "Computes the left, right and two-sided cells of a W-graph written by ./verify -wgraph." << endl;
+		cout << "Optional argument:  -list prints the size of each cell and its shortest element." << endl;
+		return 0; 
+	}
+
+	string na = argv[1];
+	cout << "Coxeter type " << na << " with Coxeter matrix: " << endl;
+
+	CoxeterRegistry registry;
+	CoxeterSystem* coxeter_system = registry.get(na);
+	if (coxeter_system == NULL) { cout << "Coxeter type not supported." << endl;  return 0; }
+	coxeter_system->print_matrix();
+
+	int list_cells = 0;
+	for (int i = 3; i < argc; i++)
+	{
+		string a = argv[i];
+		if (a == "-list") { list_cells = 1; }
+	}
+
+	WGraph g(argv[2]);
+	if (g.vertex_count < 0) { return 0; }
+	if (g.size != coxeter_system->size) { cout << "ERROR:  " << argv[2] << " is not a W-graph for this Coxeter system." << endl;  return 0; }
+	cout << "W-graph with " << g.vertex_count << " vertices and " << (g.edge_count / 2) << " edges." << endl;
+
+	ElementIndex index(coxeter_system);
+	if (list_cells == 1 && index.get_order() == 0) { cout << "(Ignoring -list, since the elements of this group are not ranked.)" << endl;  list_cells = 0; }
+	print_cells(g, index, "Left", LEFT, list_cells);
+	print_cells(g, index, "Right", RIGHT, list_cells);
+	print_cells(g, index, "Two-sided", LEFT | RIGHT, list_cells);
+	return 0;
+}
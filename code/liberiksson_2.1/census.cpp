@@ -0,0 +1,145 @@
+#include "CoxeterElement.h"
+#include "CoxeterRegistry.h"
+#include "GroupEnumerator.h"
+#include "CosetElement.h"
+#include "KLTable.h"
+
+/////////////////////////////////////////////////////////////////////
+//
+//  This is code which runs through every element of a Coxeter group
+//  without storing any of them, and tallies the number of elements
+//  of each length (the coefficients of the Poincare polynomial) and
+//  the number of elements with each number of right descents.
+//
+//  With -cosets, the elements are run through by their index along a
+//  ParabolicChain (as CosetElements) instead of by the numbers game.
+//
+//  With -kl, the Kazhdan-Lusztig polynomials P_{x,y} of all pairs in
+//  the group are computed (see KLTable), and the number of distinct
+//  polynomials and the largest mu-coefficient are printed.
+//
+/////////////////////////////////////////////////////////////////////
+
+struct Census
+{
+	vector<long long> by_length;
+	vector<long long> by_descents;
+};
+
+int add_to_census(CoxeterElement& w, void* data)
+{
+	Census* census = (Census*) data;
+
+	if (w.length >= census->by_length.size()) { census->by_length.resize(w.length+1, 0); }
+	census->by_length[w.length]++;
+
+	int d = 0;
+	for (int s = 0; s < w.size; s++) { if (w.word[s] < 0) { d++; } }
+	census->by_descents[d]++;
+
+	return 1;
+}
+
+/////////////////////////////////////////////////////////////////////
+// Input:  Coxeter matrix (type), -max <length> (optional)
+// Output:  number of elements of each length, and of each descent number.
+/////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) { 
+		cout << "No arguments given." << endl;  
+                cout << "Usage:  ./census E7" << endl;
+                cout << "Counts the elements of the Coxeter group by length and by number of right descents." << endl;
+		cout << "Optional argument:  -max <length> only counts the elements of length at most <length>." << endl;
+		cout << "Optional argument:  -cosets uses the parabolic coset representation of the elements." << endl;
+		cout << "Optional argument:  -kl also computes all of the Kazhdan-Lusztig polynomials of the group." << endl;
+		cout << "The type may be any of A1.., B2.., D3.., E6-E8, F4, G2, H3, H4, I2(m), A~1.., C~2.., D~4.., or a file holding the rank and Coxeter matrix." << endl;
+		return 0; 
+	}
+
+	string na = argv[1];
+	cout << "Coxeter type " << na << " with Coxeter matrix: " << endl;
+
+	CoxeterRegistry registry;
+	CoxeterSystem* coxeter_system = registry.get(na);
+	if (coxeter_system == NULL) { cout << "Coxeter type not supported." << endl;  return 0; }
+	coxeter_system->print_matrix();
+
+	int max_length = 0;
+	int use_cosets = 0;
+	int compute_kl = 0;
+	for (int i = 2; i < argc; i++)
+	{
+		string a = argv[i];
+		if (a == "-max" && i+1 < argc) { i++; max_length = atoi(argv[i]); }
+		else if (a == "-cosets") { use_cosets = 1; }
+		else if (a == "-kl") { compute_kl = 1; }
+	}
+
+	if (coxeter_system->is_finite() == 0 && (max_length <= 0 || use_cosets == 1 || compute_kl == 1))
+	{ cout << "This group is infinite:  use -max, without -cosets or -kl." << endl;  return 0; }
+
+	Census census;
+	census.by_descents.resize(coxeter_system->size + 1, 0);
+
+	long long total = 0;
+	if (use_cosets == 1)
+	{
+		ParabolicChain chain(coxeter_system);
+		CosetElement w(&chain);
+		for (long long r = 0; r < chain.get_order(); r++)
+		{
+			w.set_index(r);
+			if (max_length > 0 && w.length > max_length) { continue; }
+
+			if (w.length >= census.by_length.size()) { census.by_length.resize(w.length+1, 0); }
+			census.by_length[w.length]++;
+
+			int d = 0;
+			for (int s = 0; s < w.size; s++) { if (w.has_right_descent(s)) { d++; } }
+			census.by_descents[d]++;
+			total++;
+		}
+	}
+	else
+	{
+		GroupEnumerator elements(coxeter_system, max_length);
+		total = elements.for_each(add_to_census, &census);
+	}
+
+	cout << "Number of elements of each length: " << endl;
+	for (int l = 0; l < census.by_length.size(); l++)
+	{ cout << "  " << l << ":  " << census.by_length[l] << endl; }
+
+	cout << "Number of elements with each number of right descents: " << endl;
+	for (int d = 0; d < census.by_descents.size(); d++)
+	{ cout << "  " << d << ":  " << census.by_descents[d] << endl; }
+
+	cout << "Total:  " << total << " elements." << endl;
+
+	if (compute_kl == 1)
+	{
+		// the longest element:  multiply by generators that are not descents until there are none.
+		CoxeterElement w0(coxeter_system);
+		int s = 0;
+		while (s < w0.size)
+		{
+			if (w0.has_right_descent(s)) { s++; }
+			else { w0.right_multiply(s);  s = 0; }
+		}
+
+		BruhatInterval group(w0);
+		KLTable kl(&group);
+
+		int max_mu = 0;
+		for (long long k = 0; k < kl.mu_value.size(); k++) { if (kl.mu_value[k] > max_mu) { max_mu = kl.mu_value[k]; } }
+
+		int max_coefficient = 0;
+		for (long long k = 0; k < kl.pool_coefficients.size(); k++) { if (kl.pool_coefficients[k] > max_coefficient) { max_coefficient = kl.pool_coefficients[k]; } }
+
+		cout << "Kazhdan-Lusztig polynomials:  " << kl.get_stored_pairs() << " stored pairs (x,y), " << kl.get_pool_size() << " distinct polynomials." << endl;
+		cout << "Largest mu-coefficient:  " << max_mu << ".  Largest coefficient:  " << max_coefficient << "." << endl;
+	}
+	return 0;
+}
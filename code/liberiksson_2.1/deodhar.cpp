@@ -1,228 +1,431 @@
-#include "CoxeterElement.h"
-#include "Masks.h"
-
-/////////////////////////////////////////////////////////////////////
-//
-//  This is code which tests a given element for the Deodhar 
-//  property.
-//
-/////////////////////////////////////////////////////////////////////
-
-static const int DEBUG_VERBOSE_GEN = 0;
-static const int VERBOSE = 0;
-
-struct strCmp {
-    bool operator()( string s1, string s2 ) const {
-      return ( s1 < s2 );
-    }
-};
-
-
-/////////////////////////////////////////////////////////////////////
-// Input:  Coxeter matrix (type), w redexp, x redexp, -mu flag (optional)
-// Output:  Mu coefficient, P_{x,w} if x provided, or the entire C'_{x,w} if not.
-/////////////////////////////////////////////////////////////////////
-
-int main(int argc, char* argv[])
-{
-	if (argc < 2) { 
-		cout << "No arguments given." << endl;  
-                cout << "Usage:  ./deodhar A3 -w 1021" << endl;
-                cout << "Given a reduced expression for a Deodhar element," << endl;
-                cout << "returns the Kazhdan-Lusztig basis element." << endl;
-		cout << "Optional argument:  -x <reduced expression> only prints the polynomial P_{x,w}(q)." << endl;
-		cout << "Optional argument:  -mu prints the mu-coefficients." << endl;
-		cout << "Optional argument:  -masks prints all masks." << endl;
-		return 0; 
-	}
-
-	string na = argv[1];
-	cout << "Coxeter type " << na << " with Coxeter matrix: " << endl;
-
-	CoxeterNames names;
-	CoxeterSystem* coxeter_system = names.names[ na ];
-	if (coxeter_system == NULL) { cout << "Coxeter type not supported." << endl;  return 0; }
-	coxeter_system->print_matrix();
-
-	string w_s = "";
-	string x_s = "";
-	int look_for_mu = 0;
-	int print_all_masks = 0;
-	int w_is_not_deodhar = 0;
-
-	for (int i = 2; i < argc; i++)
-	{
-		string a = argv[i];
-		if (a == "-w") { i++; w_s = argv[i]; }
-		else if (a == "-x") { i++; x_s = argv[i]; }
-		else if (a == "-mu") { look_for_mu = 1;  print_all_masks = 1; }
-		else if (a == "-masks") { print_all_masks = 1; }
-		//else if (a == "-conj") { test_conj = 1; }
-	}
-
-	if (w_s == "") { cout << "No w expression given." << endl;  return 0; }
-
-        int w_red_l = w_s.length();
-        int w_red[w_red_l];
-
-        for (int i=0; i < w_red_l; i++)
-        {
-		stringstream strstr(w_s.substr(i,1));
-                strstr >> w_red[i];
-                //w_red[i] = atoi( &(w_s.c_str()[i]) );
-        }
-
-	CoxeterElement w = CoxeterElement(coxeter_system, w_red, w_red_l);
-	string w_name;
-	w.sprint_reduced_expression(w_name);
-	cout << "w is using reduced expression " << endl;
-	cout << "....:  " << w_name << "." << endl;
-
-        int x_red_l = x_s.length();
-        int x_red[w_red_l];
-	string x_name;
-
-        for (int i=0; i < x_red_l; i++)
-        {
-	  stringstream strstr(x_s.substr(i,1));
-          strstr >> x_red[i];
-        }
-
-	CoxeterElement x = CoxeterElement(coxeter_system, x_red, x_red_l);
-
-	if (x_s != "")
-	{
-	  x.sprint_reduced_expression(x_name);
-	  cout << "x is using reduced expression " << x_name << "." << endl;
-	}
-
-	map< string, map<string, int> > kl_basis_element;  // T_oneline is the first index, and q^defects is the second index.
-
-	int length = w.length;
-	int reduced_expression[length];
-
-	w.get_reduced_expression(reduced_expression);
-
-        Masks masks(length);
-        while (masks.exhausted() == 0)
-        {
-		// print mask to string.
-		string mask_as_string;
-		masks.sprint(mask_as_string);
-
-                // calculate the contribution of this mask to the Kazhdan-Lusztig basis element.
-                int defect_count = 0;
-                CoxeterElement t(coxeter_system);
-                for (int i = 0; i < length; i++)
-                {
-                        // build indexing element using 1-entries through this position i.
-                        if (masks.get_value(i) == 1)
-                        { t.right_multiply(reduced_expression[i]); }
-
-                        // see if this position is a defect:  is reduced_expression[i+1] a right descent for t?
-                        if (i < length-1 && t.has_right_descent(reduced_expression[i+1]))
-                        { 
-				defect_count++; 
-				mask_as_string.erase(2*(i+2)+1, 1);
-				mask_as_string.insert(2*(i+2)+1, "d");
-			}
-                }
-
-                string t_basis;
-		t.sprint_reduced_expression(t_basis);
-
-		// Check the Deodhar statistic:  1 = mu mask, 0 = not Deodhar.
-		int deodhar_statistic = (length - t.get_length()) - (2*defect_count);
-		if (deodhar_statistic <= 0 && masks.proper())
-		{
-			if (print_all_masks == 1)
-			{
-			  w_is_not_deodhar = 1;
-			}
-			else
-			{
-			  cout << "The element w has non-Deodhar mask:" << endl;
-			  cout << mask_as_string << endl;
-			  return 0;
-			}
-		}
-
-                string q_monomial;
-                if (defect_count == 0) { q_monomial = "1"; }
-                else if (defect_count == 1) { q_monomial = "q"; }
-                else
-                {
-                        stringstream s;
-                        s << defect_count;
-                        q_monomial = "q^" + s.str();
-                }
-
-                kl_basis_element[t_basis][q_monomial]++;
-
-		if (print_all_masks == 1)
-		{
-			if ((x_s == "") || (t_basis == x_name)) 
-			{
-			  if (look_for_mu == 0 || (look_for_mu == 1 && deodhar_statistic == 1))
-			  {
-			  cout << "mask:  ";
-			  cout << mask_as_string << ":  " << q_monomial;
-
-			  if (deodhar_statistic == 1)
- 			  {
-			    cout << " (mu mask) ";
-			  }
-			  if (deodhar_statistic <= 0 && masks.proper())
-			  {
-			    cout << " (not Deodhar) ";
-			  }
-			  cout << endl;
-			  }
-			}
-		}
-
-                //cout << "  adding " << q_monomial << " for " << t_basis << "  (" << defect_count << ")  " ;
-                //masks.print();
-
-                masks.next();
-        }
-
-	if (w_is_not_deodhar == 0)
-	{
-        cout << "In lex order on reduced expressions: " << endl;
-        for( map<string, map<string, int>, strCmp>::iterator iter = kl_basis_element.begin(); iter != kl_basis_element.end(); iter++ )
-        {
-                string t_name = (*iter).first;
-
-		// if x is defined, then restrict to P_{x,w} entry.
-		if (!(x_s == "") && !(t_name == x_name)) { continue; } 
-
-                string q_polynomial;
-                int started = 0;
-                for( map<string, int, strCmp>::iterator iter2 = (*iter).second.begin(); iter2 != (*iter).second.end(); iter2++ )
-                {
-                        if (started == 1) { q_polynomial = q_polynomial + " + "; }
-
-                        if ((*iter2).second == 1)
-                        {
-                          q_polynomial = q_polynomial + (*iter2).first;
-                        }
-                        else
-                        {
-                          stringstream s;
-                          s << (*iter2).second;
-                          q_polynomial = q_polynomial + s.str() + "." + (*iter2).first;
-                        }
-
-                        started = 1;
-                }
-
-		        // check w_s is the internal reduced experession, so masks match up.
-                string statement = "P(" + w_name + "," + t_name + ") = " + q_polynomial;
-                cout << statement;
-
-		cout << endl;
-	}
-	}
-}
-
+#include "CoxeterElement.h"
+#include "CoxeterRegistry.h"
+#include "Masks.h"
+#include "ElementIndex.h"
+#include "CayleyTable.h"
+#include "HeckeElement.h"
+#include "KLTable.h"
+
+/////////////////////////////////////////////////////////////////////
+//
+//  This is code which tests a given element for the Deodhar 
+//  property.
+//
+/////////////////////////////////////////////////////////////////////
+
+static const int DEBUG_VERBOSE_GEN = 0;
+static const int VERBOSE = 0;
+
+struct strCmp {
+    bool operator()( string s1, string s2 ) const {
+      return ( s1 < s2 );
+    }
+};
+
+
+/////////////////////////////////////////////////////////////////////
+// Input:  Coxeter matrix (type), w redexp, x redexp, -mu flag (optional)
+// Output:  Mu coefficient, P_{x,w} if x provided, or the entire C'_{x,w} if not.
+/////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) { 
+		cout << "No arguments given." << endl;  
+                cout << "Usage:  ./deodhar A3 -w 1021" << endl;
+                cout << "(Generators past 9 need separators, as in ./deodhar D12 -w 10,11,9,10.)" << endl;
+                cout << "Given a reduced expression for a Deodhar element," << endl;
+                cout << "returns the Kazhdan-Lusztig basis element." << endl;
+		cout << "Optional argument:  -x <reduced expression> only prints the polynomial P_{x,w}(q)." << endl;
+		cout << "Optional argument:  -mu prints the mu-coefficients." << endl;
+		cout << "Optional argument:  -masks prints all masks." << endl;
+		cout << "Optional argument:  -table <file> maps the Cayley table from <file>, writing it there first if necessary." << endl;
+		cout << "Optional argument:  -table-threshold <n> only uses a Cayley table for groups with at most n elements (0 = never)." << endl;
+		cout << "Optional argument:  -interval prints the number of elements of each length in the Bruhat interval [e, w]." << endl;
+		cout << "Optional argument:  -bar checks that the basis element is invariant under the bar involution (needs a Cayley table)." << endl;
+		cout << "Optional argument:  -r also prints the R-polynomials R_{x,w}(q) (w need not be Deodhar)." << endl;
+		cout << "Optional argument:  -kl computes the polynomials by the Kazhdan-Lusztig recursion instead of by masks (w need not be Deodhar)." << endl;
+		cout << "The type may be any of A1.., B2.., D3.., E6-E8, F4, G2, H3, H4, I2(m), A~1.., C~2.., D~4.., or a file holding the rank and Coxeter matrix." << endl;
+		return 0; 
+	}
+
+	string na = argv[1];
+	cout << "Coxeter type " << na << " with Coxeter matrix: " << endl;
+
+	CoxeterRegistry registry;
+	CoxeterSystem* coxeter_system = registry.get(na);
+	if (coxeter_system == NULL) { cout << "Coxeter type not supported." << endl;  return 0; }
+	coxeter_system->print_matrix();
+
+	string w_s = "";
+	string x_s = "";
+	int look_for_mu = 0;
+	int print_all_masks = 0;
+	int w_is_not_deodhar = 0;
+	int print_interval = 0;
+	int use_kl_recursion = 0;
+	int check_bar = 0;
+	int compute_r = 0;
+	string table_file = "";
+	long long table_threshold = CAYLEY_TABLE_DEFAULT_THRESHOLD;
+
+	for (int i = 2; i < argc; i++)
+	{
+		string a = argv[i];
+		if (a == "-w") { i++; w_s = argv[i]; }
+		else if (a == "-x") { i++; x_s = argv[i]; }
+		else if (a == "-mu") { look_for_mu = 1;  print_all_masks = 1; }
+		else if (a == "-masks") { print_all_masks = 1; }
+		else if (a == "-table" && i+1 < argc) { i++; table_file = argv[i]; }
+		else if (a == "-table-threshold" && i+1 < argc) { i++; table_threshold = atoll(argv[i]); }
+		else if (a == "-interval") { print_interval = 1; }
+		else if (a == "-kl") { use_kl_recursion = 1; }
+		else if (a == "-bar") { check_bar = 1; }
+		else if (a == "-r") { compute_r = 1; }
+		//else if (a == "-conj") { test_conj = 1; }
+	}
+
+	if (w_s == "") { cout << "No w expression given." << endl;  return 0; }
+
+        int w_red[w_s.length()];
+        int w_red_l = coxeter_system->parse_word(w_s, w_red);
+        if (w_red_l < 0) { return 0; }
+
+	CoxeterElement w = CoxeterElement(coxeter_system, w_red, w_red_l);
+	string w_name;
+	w.sprint_reduced_expression(w_name);
+	cout << "w is using reduced expression " << endl;
+	cout << "....:  " << w_name << "." << endl;
+
+	if (print_interval == 1)
+	{
+		BruhatInterval interval(w);
+		cout << "The Bruhat interval [e, w] has " << interval.get_count() << " elements and " << interval.get_cover_count() << " cover relations." << endl;
+		cout << "Elements by length:  ";
+		for (int l = 0; l <= interval.top_length; l++) { cout << interval.get_level_size(l) << " "; }
+		cout << endl;
+	}
+
+        int x_red[x_s.length() + 1];
+        int x_red_l = coxeter_system->parse_word(x_s, x_red);
+        if (x_red_l < 0) { return 0; }
+	string x_name;
+
+	CoxeterElement x = CoxeterElement(coxeter_system, x_red, x_red_l);
+
+	if (x_s != "")
+	{
+	  x.sprint_reduced_expression(x_name);
+	  cout << "x is using reduced expression " << x_name << "." << endl;
+
+	  // no mask can index x unless x <= w in the Bruhat order.
+	  if (x.bruhat_leq(w) == 0)
+	  {
+	    cout << "x is not below w in the Bruhat order, so P(" << w_name << "," << x_name << ") = 0." << endl;
+	    return 0;
+	  }
+	}
+
+	if (use_kl_recursion == 1)
+	{
+		BruhatInterval interval(w);
+		KLTable kl(&interval);
+		int top = interval.find(w);
+
+		map<string, string> polynomials;
+		for (int t = 0; t < interval.get_count(); t++)
+		{
+			CoxeterElement t_element = interval.get_element(t);
+			string t_name;
+			t_element.sprint_reduced_expression(t_name);
+			if (!(x_s == "") && !(t_name == x_name)) { continue; }
+
+			kl.sprint_polynomial(kl.get_polynomial(t, top), polynomials[t_name]);
+		}
+
+		cout << "In lex order on reduced expressions: " << endl;
+		for (map<string, string>::iterator iter = polynomials.begin(); iter != polynomials.end(); iter++)
+		{ cout << "P(" << w_name << "," << (*iter).first << ") = " << (*iter).second << endl; }
+		return 0;
+	}
+
+	map< string, map<string, int> > kl_basis_element;  // T_oneline is the first index, and q^defects is the second index.
+
+	int length = w.length;
+	int reduced_expression[length];
+
+	w.get_reduced_expression(reduced_expression);
+
+	// For small groups, multiply in the mask loop using a Cayley table.
+	ElementIndex index(coxeter_system);
+	CayleyTable* table = NULL;
+	if (index.get_order() > 0 && index.get_order() <= table_threshold)
+	{
+		if (table_file != "")
+		{
+			table = new CayleyTable(&index, table_file.c_str());
+			if (table->order == 0) { delete table;  table = NULL; }
+		}
+		if (table == NULL)
+		{
+			table = new CayleyTable(&index);
+			if (table_file != "") { table->save(table_file.c_str()); }
+		}
+	}
+	map<long long, string> table_names;  // reduced expressions of the table elements seen so far.
+	if (compute_r == 1 && index.get_order() == 0) { cout << "The -r option needs a finite group whose order fits in a long long." << endl;  compute_r = 0; }
+	if (check_bar == 1 && table == NULL) { cout << "The -bar option needs a Cayley table (see -table-threshold)." << endl;  check_bar = 0; }
+	HeckeElement basis_element(table);  // C'_w = v^{-l(w)} sum over masks of q^{defects} T_t.
+	int one[1] = {1};
+
+	// R_{x,w} = sum over the masks with no 0 at a defect of q^{defects} (q-1)^{zeros}.
+	// r_terms[index of x][(length+1)*zeros + defects] counts these masks.
+	map<long long, map<int, long long> > r_terms;
+	map<long long, string> r_names;
+
+        Masks masks(length);
+        while (masks.exhausted() == 0)
+        {
+		// print mask to string.
+		string mask_as_string;
+		masks.sprint(mask_as_string);
+
+                // calculate the contribution of this mask to the Kazhdan-Lusztig basis element.
+                int defect_count = 0;
+                int t_length = 0;
+                string t_basis;
+                int r_mask = 1;  // 0 if some defect has mask value 0.
+                int zero_count = 0;
+                long long t_index = 0;
+
+		if (table != NULL)
+		{
+                  long long t = table->identity;
+                  for (int i = 0; i < length; i++)
+                  {
+                        if (masks.get_value(i) == 1)
+                        { t = table->right_multiply(t, reduced_expression[i]); }
+                        else { zero_count++; }
+
+                        if (i < length-1 && table->has_right_descent(t, reduced_expression[i+1]))
+                        { 
+				defect_count++; 
+				if (masks.get_value(i+1) == 0) { r_mask = 0; }
+				mask_as_string.erase(2*(i+2)+1, 1);
+				mask_as_string.insert(2*(i+2)+1, "d");
+			}
+                  }
+
+                  t_length = table->get_length(t);
+                  if (check_bar == 1) { basis_element.add_term(t, (2*defect_count) - length, one, 1); }
+                  if (table_names.find(t) == table_names.end()) { table->sprint_reduced_expression(t, table_names[t]); }
+                  t_basis = table_names[t];
+                  t_index = t;
+		}
+		else
+		{
+                  CoxeterElement t(coxeter_system);
+                  for (int i = 0; i < length; i++)
+                  {
+                        // build indexing element using 1-entries through this position i.
+                        if (masks.get_value(i) == 1)
+                        { t.right_multiply(reduced_expression[i]); }
+                        else { zero_count++; }
+
+                        // see if this position is a defect:  is reduced_expression[i+1] a right descent for t?
+                        if (i < length-1 && t.has_right_descent(reduced_expression[i+1]))
+                        { 
+				defect_count++; 
+				if (masks.get_value(i+1) == 0) { r_mask = 0; }
+				mask_as_string.erase(2*(i+2)+1, 1);
+				mask_as_string.insert(2*(i+2)+1, "d");
+			}
+                  }
+
+                  t_length = t.get_length();
+		  t.sprint_reduced_expression(t_basis);
+		  if (compute_r == 1 && r_mask == 1) { t_index = index.rank(t); }
+		}
+
+		if (compute_r == 1 && r_mask == 1)
+		{
+			r_terms[t_index][((length+1) * zero_count) + defect_count]++;
+			if (r_names.find(t_index) == r_names.end()) { r_names[t_index] = t_basis; }
+		}
+
+		// Check the Deodhar statistic:  1 = mu mask, 0 = not Deodhar.
+		int deodhar_statistic = (length - t_length) - (2*defect_count);
+		if (deodhar_statistic <= 0 && masks.proper())
+		{
+			if (print_all_masks == 1 || compute_r == 1)
+			{
+			  w_is_not_deodhar = 1;
+			}
+			else
+			{
+			  cout << "The element w has non-Deodhar mask:" << endl;
+			  cout << mask_as_string << endl;
+			  return 0;
+			}
+		}
+
+                string q_monomial;
+                if (defect_count == 0) { q_monomial = "1"; }
+                else if (defect_count == 1) { q_monomial = "q"; }
+                else
+                {
+                        stringstream s;
+                        s << defect_count;
+                        q_monomial = "q^" + s.str();
+                }
+
+                kl_basis_element[t_basis][q_monomial]++;
+
+		if (print_all_masks == 1)
+		{
+			if ((x_s == "") || (t_basis == x_name)) 
+			{
+			  if (look_for_mu == 0 || (look_for_mu == 1 && deodhar_statistic == 1))
+			  {
+			  cout << "mask:  ";
+			  cout << mask_as_string << ":  " << q_monomial;
+
+			  if (deodhar_statistic == 1)
+ 			  {
+			    cout << " (mu mask) ";
+			  }
+			  if (deodhar_statistic <= 0 && masks.proper())
+			  {
+			    cout << " (not Deodhar) ";
+			  }
+			  cout << endl;
+			  }
+			}
+		}
+
+                //cout << "  adding " << q_monomial << " for " << t_basis << "  (" << defect_count << ")  " ;
+                //masks.print();
+
+                masks.next();
+        }
+
+	if (w_is_not_deodhar == 0)
+	{
+        cout << "In lex order on reduced expressions: " << endl;
+        for( map<string, map<string, int>, strCmp>::iterator iter = kl_basis_element.begin(); iter != kl_basis_element.end(); iter++ )
+        {
+                string t_name = (*iter).first;
+
+		// if x is defined, then restrict to P_{x,w} entry.
+		if (!(x_s == "") && !(t_name == x_name)) { continue; } 
+
+                string q_polynomial;
+                int started = 0;
+                for( map<string, int, strCmp>::iterator iter2 = (*iter).second.begin(); iter2 != (*iter).second.end(); iter2++ )
+                {
+                        if (started == 1) { q_polynomial = q_polynomial + " + "; }
+
+                        if ((*iter2).second == 1)
+                        {
+                          q_polynomial = q_polynomial + (*iter2).first;
+                        }
+                        else
+                        {
+                          stringstream s;
+                          s << (*iter2).second;
+                          q_polynomial = q_polynomial + s.str() + "." + (*iter2).first;
+                        }
+
+                        started = 1;
+                }
+
+		        // check w_s is the internal reduced experession, so masks match up.
+                string statement = "P(" + w_name + "," + t_name + ") = " + q_polynomial;
+                cout << statement;
+
+		cout << endl;
+	}
+
+	if (check_bar == 1)
+	{
+		HeckeElement image(basis_element);
+		image.bar();
+		if (image.equals(basis_element)) { cout << "C'_w is invariant under the bar involution." << endl; }
+		else { cout << "ERROR:  C'_w is not invariant under the bar involution." << endl; }
+	}
+	}
+
+	if (compute_r == 1)
+	{
+		map<string, string> r_polynomials;
+		map<long long, vector<long long> > r_coefficients;
+		for (map<long long, map<int, long long> >::iterator iter = r_terms.begin(); iter != r_terms.end(); iter++)
+		{
+			// expand q^b (q-1)^a.
+			vector<long long>& r = r_coefficients[(*iter).first];
+			r.assign(length+1, 0);
+			for (map<int, long long>::iterator iter2 = (*iter).second.begin(); iter2 != (*iter).second.end(); iter2++)
+			{
+				int a = (*iter2).first / (length+1);
+				int b = (*iter2).first % (length+1);
+				long long binomial = 1;
+				for (int k = 0; k <= a; k++)
+				{
+					long long term = ((a - k) % 2 == 0) ? binomial : -binomial;
+					r[b+k] += (*iter2).second * term;
+					binomial = (binomial * (a - k)) / (k + 1);
+				}
+			}
+
+			string q_polynomial;
+			for (int k = 0; k <= length; k++)
+			{
+				if (r[k] == 0) { continue; }
+				if (q_polynomial != "") { q_polynomial = q_polynomial + ((r[k] < 0) ? " - " : " + "); }
+				else if (r[k] < 0) { q_polynomial = "-"; }
+
+				long long c = (r[k] < 0) ? -r[k] : r[k];
+				stringstream monomial;
+				if (k == 0) { monomial << c; }
+				else
+				{
+					if (c != 1) { monomial << c << "."; }
+					monomial << "q";
+					if (k != 1) { monomial << "^" << k; }
+				}
+				q_polynomial = q_polynomial + monomial.str();
+			}
+			r_polynomials[ r_names[(*iter).first] ] = q_polynomial;
+		}
+
+		if (w_is_not_deodhar == 1 && print_all_masks == 0) { cout << "The element w is not Deodhar, so only the R-polynomials are printed." << endl; }
+		cout << "R-polynomials in lex order on reduced expressions: " << endl;
+		for (map<string, string>::iterator iter = r_polynomials.begin(); iter != r_polynomials.end(); iter++)
+		{
+			if (!(x_s == "") && !((*iter).first == x_name)) { continue; }
+			cout << "R(" << w_name << "," << (*iter).first << ") = " << (*iter).second << endl;
+		}
+
+		// check against T_{w^{-1}}^{-1} = (-1)^{l(w)} q^{-l(w)} sum_x (-1)^{l(x)} R_{x,w}(q) T_x.
+		if (table != NULL)
+		{
+			HeckeElement inverse(table, table->identity);
+			for (int i = 0; i < length; i++) { inverse.right_multiply_T_inverse(reduced_expression[i]); }
+
+			HeckeElement expected(table);
+			vector<int> v_coefficients(2*length + 1);
+			for (map<long long, vector<long long> >::iterator iter = r_coefficients.begin(); iter != r_coefficients.end(); iter++)
+			{
+				int sign = ((length + table->get_length((*iter).first)) % 2 == 0) ? 1 : -1;
+				for (int k = 0; k <= 2*length; k++) { v_coefficients[k] = (k % 2 == 0) ? sign * (*iter).second[k/2] : 0; }
+				expected.add_term((*iter).first, -2*length, &(v_coefficients[0]), 2*length + 1);
+			}
+
+			if (inverse.equals(expected)) { cout << "The R-polynomials agree with T_{w^{-1}}^{-1} in the Hecke algebra." << endl; }
+			else { cout << "ERROR:  the R-polynomials do not agree with T_{w^{-1}}^{-1} in the Hecke algebra." << endl; }
+		}
+	}
+
+	if (table != NULL) { delete table; }
+	return 0;
+}
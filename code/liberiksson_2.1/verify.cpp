@@ -1,547 +1,893 @@
-#include "CoxeterElement.h"
-#include "Masks.h"
-
-/////////////////////////////////////////////////////////////////////
-//
-//  This is code which classifies the minimally non-Deodhar elements
-//  of various Coxeter groups.
-//  
-//  We also verify the "mu in {0,1}" property for 
-//  Deodhar elements of these Coxeter groups.
-//
-/////////////////////////////////////////////////////////////////////
-
-static const int DEBUG_VERBOSE_GEN = 0;
-static const int VERBOSE = 0;
-
-// generates all the elements above t in the 2-weak order, puts them in PROCESSED_ELEMENTS.
-int generate_up_ideal(CoxeterElement& t, int max_length, vector<CoxeterElement>& PROCESSED_ELEMENTS)
-{
-	list<CoxeterElement> toproc;
-	toproc.push_back(t);
-
-	while (!toproc.empty())
-	{
-		CoxeterElement current = toproc.front();
-		toproc.pop_front();
-
-		if (max_length > 0 && current.length > max_length) { return 0; }
-
-		int* reduced = new int[current.length];
-		current.get_reduced_expression(reduced);
-
-		// see if current elt has already been processed
-		int match_exists = 0;
-		for (int i = 0; i < PROCESSED_ELEMENTS.size(); i++)
-		{
-			if ( current.equals(&(PROCESSED_ELEMENTS[i])) == 1 )
-			{ match_exists = 1; }
-		}
-
-		if ( match_exists != 0 )
-		{
-			delete reduced;
-			continue;
-		}
-
-		if (DEBUG_VERBOSE_GEN)
-		{ cout << "adding "; current.print(); current.print_reduced_expression(); }
-
-		// add current elt
-		PROCESSED_ELEMENTS.push_back( current );
-
-		// hit current on the right with all possible generators, s.t. it is short-braid-avoiding
-		for (int i = 0; i < current.size; i++)
-		{
-		  if (current.word[i] > 0) 
-		  { 
-			int non_comms = 0;
-			
-			// search backwards for generator i:
-			int k = 0;
-			for ( k = current.length-1 ; k >= 0; k-- ) { if (reduced[k] == i) { break; } }
-
-			if ( k >= 0 )
-			{
-			  // search forwards for non commuting gens...
-			  for ( int m = k+1 ; m < current.length; m++ )
-			  {
-				if (current.coxeter_system->get_exponent(i, reduced[m]) >= 3) { non_comms++; }
-			  }
-			}
-			else { non_comms = 2; }
-			
-			if ( non_comms >=2 )
-			{
-		    	  if (DEBUG_VERBOSE_GEN) { cout << "multiplying by " << i << " and adding to list." << endl; }
-			  CoxeterElement v = CoxeterElement(current.coxeter_system, current.word, current.one_line);
-			  v.right_multiply(i);
-			  toproc.push_back(v);
-			}
-			else
-			{
-		    	  if (DEBUG_VERBOSE_GEN) { cout << "multiplying by " << i << " would create short-braid." << endl; }
-			}
-		  }
-		}
-
-		// hit current on the left with all possible generators, s.t. it is short-braid-avoiding
-		for (int i = 0; i < current.size; i++)
-		{
-			int non_comms = 0;
-			
-			// search forwards for generator i:
-			int k = 0;
-			for ( k = 0; k < current.length; k++ ) { if (reduced[k] == i) { break; } }
-
-			if ( k < current.length )
-			{
-			  // search back for non commuting gens...
-			  for ( int m = k ; m >= 0; m-- )
-			  {
-				if (current.coxeter_system->get_exponent(i, reduced[m]) >= 3) { non_comms++; }
-			  }
-			}
-			else { non_comms = 2; }
-			
-			if ( non_comms >=2 )
-			{
-		    	  if (DEBUG_VERBOSE_GEN) { cout << "left multiplying by " << i << " and adding to list." << endl; }
-			  CoxeterElement v = CoxeterElement(current.coxeter_system, current.word, current.one_line);
-			  v.left_multiply(i);
-			  if (v.get_length() > current.length) { toproc.push_back(v); }
-			}
-			else
-			{
-		    	  if (DEBUG_VERBOSE_GEN) { cout << "left multiplying by " << i << " would create short-braid." << endl; }
-			}
-		}
-
-		delete reduced;
-	} // end while there are elements yet to process
-}
-
-int generate_all_elements_breadth_first(CoxeterSystem* coxeter_system, int max_length)
-{
-	int deodhar_count = 0;  // Keep enumeration for futher directions section of paper.
-	int total_count = 0;    // This won't match the total # elts in group since we cut the recursion when we find a bad pattern.
-
-	vector<CoxeterElement> PROCESSED_ELEMENTS;
-	vector<CoxeterElement> NON_DEODHAR_PATTERNS;
-	list<CoxeterElement> toproc;
-
-	// initialization of bad D8 1-line pattern:
-	int D8_PATTERN_OL[9] = { -1, 6, 7, 8, -5, 2, 3, 4, 9}; int D8_PATTERN_W[8] = {5, 5, 1, 1, -11, 5, 1, 1};
-	CoxeterElement D8_PATTERN = CoxeterElement(&D8, D8_PATTERN_W, D8_PATTERN_OL); 
-
-	CoxeterElement t = CoxeterElement(coxeter_system);  // create identity elt.
-	toproc.push_back(t);
-
-	int current_length = -1;
-
-	while (!toproc.empty())
-	{
-		CoxeterElement current = toproc.front();
-
-		toproc.pop_front();
-
-		if (max_length > 0 && current.length > max_length) { return 0; }
-		if (current_length < current.length) 
-		{ 
-			current_length = current.length;  
-			cout << "  (evaluating length " << current_length << " elements, with " << toproc.size() << " elements left to process...) " << endl; 
-		}
-
-		int* reduced = new int[current.length];
-		current.get_reduced_expression(reduced);
-
-		// see if current elt has already been processed
-		int match_exists = 0;
-		for (int i = 0; i < PROCESSED_ELEMENTS.size(); i++)
-		{
-			if ( current.equals(&(PROCESSED_ELEMENTS[i])) == 1 )
-			{ match_exists = 1; }
-		}
-
-		if ( match_exists == 1 )
-		{
-			delete reduced;
-			continue;
-		}
-
-		if (DEBUG_VERBOSE_GEN)
-		{ cout << "adding "; current.print(); current.print_reduced_expression(); }
-
-		PROCESSED_ELEMENTS.push_back( current );
-		total_count++;
-
-	map<string, int> mus;
-	int DEFAULT_MAP_VALUE = mus["undef"];
-	int dt = 1;
-        Masks masks(current.length);
-        while (masks.exhausted() == 0)
-        {
-		if (!masks.proper()) { masks.next(); continue; }
-
-                // calculate the contribution of this mask to the Kazhdan-Lusztig basis element.
-                int defect_count = 0;
-                CoxeterElement tc(coxeter_system);
-                for (int i = 0; i < current.length; i++)
-                {
-                        // build indexing element using 1-entries through this position i.
-                        if (masks.get_value(i) == 1)
-                        { tc.right_multiply(reduced[i]); }
-
-                        // see if this position is a defect:  is reduced_expression[i+1] a right descent for t?
-                        if (i < current.length-1 && tc.has_right_descent(reduced[i+1]))
-                        { defect_count++; }
-                }
-
-		// Check the Deodhar statistic:  1 = mu mask, 0 = not Deodhar.
-		int deodhar_statistic = (current.length - tc.get_length()) - (2*defect_count);
-		if (deodhar_statistic <= 0 && masks.proper())
-		{
-			dt = 0;
-			break;
-		}
-
-		// Check for mu in {0, 1}.
-		if (deodhar_statistic == 1)
-		{
-				  // The current mask is a mu-mask, so update mu values.
-				  string tc_reduced;
-				  tc.sprint_reduced_expression(tc_reduced);
-				  
-				  if (mus[ tc_reduced ] != DEFAULT_MAP_VALUE)
-				  {
-				     if(VERBOSE)
-				     {
-						cout << "WARNING:  0-1 mu property failed on: ";
-						string mm;
-						masks.sprint(mm);
-						cout << mm << endl;
-					//	print_reduced_expression();
-						cout << " (but this may be a non-Deodhar elt.)." << endl;
-				     }	
-				  }
-				  else
-				  { mus[ tc_reduced ] = 0; }
-
-				  mus[ tc_reduced ]++;
-		}
-
-                masks.next();
-        }
-
-	  	if ( dt == 1 ) 
-		{ 
-			deodhar_count++; 
-
-			// Print mu values.
-			if (VERBOSE) 
-			{
-    			cout << "w = ";
-			current.print_reduced_expression();
-			cout << endl;
-			}
-			map<string, int>::iterator iter;   
-  			for( iter = mus.begin(); iter != mus.end(); iter++ ) 
-			{
-			  if (VERBOSE)
-			  {
-    				cout << "mu = " << iter->second << " for x = " << iter->first << endl;
-			  }
-			  if (iter->second > 1) 
-			  { 
-			    cout << "ERROR:  Found NON-01 MU VALUE:  ";  current.print();  current.print_reduced_expression();
-    			    cout << "    mu = " << iter->second << " for x = " << iter->first << endl;
-			  }
-  			}
-
-			// check special 1-line pattern for any system _containing_ D8.  
-			if ( (current.coxeter_system->equals(&D8) == 1) || (current.coxeter_system->equals(&D9) == 1) || (current.coxeter_system->equals(&D10) == 1) )
-			{
-				if ( current.contains_one_line_pattern(D8_PATTERN) )
-				{ cout << "ERROR:  cannot use D8 1-line pattern for Deodhar characterization:  "; current.print(); current.print_reduced_expression(); cout << endl; }
-			}
-		}
-
-	  	if (dt == 0)
-	  	{
-			if (VERBOSE) 
-			{ cout << "  Found non-Deodhar element:  ";  current.print();  current.print_reduced_expression(); }
-
-			int contains_pattern = 0;
-
-			// see if any patterns in NON_DEODHAR_PATTERN list are _equal_ to current.
-			for (int i = 0; i < NON_DEODHAR_PATTERNS.size(); i++)
-			{
-				if (current.equals(&(NON_DEODHAR_PATTERNS[i])))
-				{
-					contains_pattern = 1;
-					break;
-				}
-			}
-
-			// If not, add current, and add up-ideals in 2-weak order generated by current and it's Coxeter embeddings to NON_DEODHAR_PATTERN list.
-			if (contains_pattern == 0)
-			{
-				// check special 1-line pattern for any system _containing_ D8.  
-				// Would be nice if there were a more generic way to do this.
-				if ( (current.coxeter_system->equals(&D8) == 1) || (current.coxeter_system->equals(&D9) == 1) || (current.coxeter_system->equals(&D10) == 1) )
-				{
-					if ( current.contains_one_line_pattern(D8_PATTERN) )
-					{ contains_pattern = 1; }
-				}
-
-				if (contains_pattern == 1)
-				{
-				  cout << "  (D8 1-line pattern found in "; current.print(); current.print_reduced_expression(); cout << " of rank " << current.get_rank(reduced) << ")" << endl;
-				}
-				else
-				{
-				  cout << "Found MINIMAL PATTERN of rank " << current.get_rank(reduced) << ":  ";  current.print();  cout << " "; current.print_reduced_expression();  cout << endl;
-				}
-
-				int rv = generate_up_ideal(current, 0, NON_DEODHAR_PATTERNS);
-		
-				for (int i = 0; i < current.coxeter_system->automorphism_group_size; i++)
-				{
-			  		CoxeterElement v = CoxeterElement(current.coxeter_system);
-					if (VERBOSE) { cout << " adding related graph automorphic element:  "; }
-					for (int j = 0; j < current.length; j++)
-					{
-			  			v.right_multiply(current.coxeter_system->get_automorphism(i, reduced[j]));
-					}
-					if (VERBOSE) { v.print(); cout << endl; }
-
-					rv = generate_up_ideal(v, 0, NON_DEODHAR_PATTERNS);
-				}
-			}
-
-			if (contains_pattern == 1 && VERBOSE)
-			{
-				cout << "  (contains previous pattern, so breaking)..." << endl;
-			}
-
-			// In any event, by lemma:  once we find a non-Deodhar pattern, there's no need to recurse further in 2-sided weak order...
-			delete reduced;
-			continue;
-		}
-
-		// Now, if the current element is Deodhar, extend it in all possible (short-braid-avoiding) ways, and add these extensions to the list of elements to process.
-		for (int i = 0; i < current.size; i++)
-		{
-		  if (current.word[i] > 0) 
-		  { 
-			int non_comms = 0;
-			
-			// search backwards for generator i:
-			int k = 0;
-			for ( k = current.length-1 ; k >= 0; k-- ) { if (reduced[k] == i) { break; } }
-
-			if ( k >= 0 )
-			{
-			  // search forwards for non commuting gens...
-			  for ( int m = k+1 ; m < current.length; m++ )
-			  {
-				if (current.coxeter_system->get_exponent(i, reduced[m]) >= 3) { non_comms++; }
-			  }
-			}
-			else { non_comms = 2; }
-			
-			if ( non_comms >=2 )
-			{
-
-		    	  if (DEBUG_VERBOSE_GEN) { cout << "multiplying by " << i << " and adding to list." << endl; }
-			  CoxeterElement v = CoxeterElement(current.coxeter_system, current.word, current.one_line);
-			  v.right_multiply(i);
-			  toproc.push_back(v);
-			}
-			else
-			{
-		    	  if (DEBUG_VERBOSE_GEN) { cout << "multiplying by " << i << " would not be fc." << endl; }
-			}
-		  }
-		}
-
-		delete reduced;
-	} // end while there are elements yet to process
-
-	cout << "Finished:  found " << deodhar_count << " Deodhar elements (out of " << total_count << " short-braid-avoiding elements processed, used " << NON_DEODHAR_PATTERNS.size() << " non-Deodhar patterns).  Also verified mu in {0,1} property for these Deodhar elements (check stdout for errors)." << endl;
-
-        if (VERBOSE)
-        { for (int i = 0; i < NON_DEODHAR_PATTERNS.size(); i++) { NON_DEODHAR_PATTERNS[i].print(); NON_DEODHAR_PATTERNS[i].print_reduced_expression(); cout << endl; } }
-
-	cout << "  (Consistency:  check that #short-braid-avoiding elts = " << (NON_DEODHAR_PATTERNS.size() + deodhar_count) <<  " = total non-Deodhar elts + Deodhar elts.)" << endl;
-	cout << endl;
-}
-
-int main(int argc, char* argv[])
-{
-	/////////////////////////////////////////////////////////////
-	//
-	// Here are # fully-commutative elts in ranks 2 - 14:  (See Stembridge for details.)
-	// Type A:  {5,14,42,132,429,1430,4862,16796,58786,208012,742900,2674440,9694845}
-	// Type B:  {7,24,83,293,1055,3860,14299,53481,201551,764217,2912167,11143499,42791039}
-	// Type D:  {4,14,48,167,593,2144,7864,29171,109173,411501,1560089,5943199,22732739}
-	// Type E:
-	//   E6:  662
-	//   E7:  2670
-	//   E8:  10846
-	//
-	/////////////////////////////////////////////////////////////
-
-	/////////////////////////////////////////////////////////////
-	//  Finite exceptional types.
-	/////////////////////////////////////////////////////////////
-
-	cout << "Type G2: " << endl;
-	G2.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&G2, 0);
-	cout << "G2 has 5 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type F4: " << endl;
-	F4.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&F4, 0);
-	cout << "F4 has 42 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	/////////////////////////////////////////////////////////////
-	//  Minimally non-Deodhar families.
-	/////////////////////////////////////////////////////////////
-
-	cout << endl << "Minimal non-Deodhar embedded factor patterns: " << endl;;
-
-	cout << "Generating minimal patterns for A7 (includes linear types BC, F4, G2, H3, H4): " << endl;
-	A7.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&A7, 0);
-	cout << "A7 has 1430 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Generating minimal patterns for D8 (excluding 1-line pattern {-1, 6, 7, 8, -5, 2, 3, 4, 9}): " << endl;
-	D8.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&D8, 0);
-	cout << "D8 has 7864 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Generating minimal patterns for E7: " << endl;
-	E7.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&E7, 0);
-	cout << "E7 has 2670 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	/////////////////////////////////////////////////////////////
-	//
-	//  Some (optional) checks for other types
-	//
-	/////////////////////////////////////////////////////////////
-
-/*
-	cout << endl << "Enumerative data and consistency checks: " << endl;;
-
-        cout << "Type E6: " << endl;
-        E6.print_matrix(); cout << endl;
-        generate_all_elements_breadth_first(&E6, 0);
-        cout << "E6 has 24 short-braid-avoiding elements." << endl;
-        cout << endl << endl;
-
-	cout << "Type E8: " << endl;
-	E8.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&E8, 0);
-	cout << "E8 has 10846 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-        cout << "Type D3: " << endl;
-        D3.print_matrix(); cout << endl;
-        generate_all_elements_breadth_first(&D3, 0);
-        cout << "D3 has 24 short-braid-avoiding elements." << endl;
-        cout << endl << endl;
-
-        cout << "Type D4: " << endl;
-        D4.print_matrix(); cout << endl;
-        generate_all_elements_breadth_first(&D4, 0);
-        cout << "D4 has 83 short-braid-avoiding elements." << endl;
-        cout << endl << endl;
-
-        cout << "Type D5: " << endl;
-        D5.print_matrix(); cout << endl;
-        generate_all_elements_breadth_first(&D5, 0);
-        cout << "D5 has 293 short-braid-avoiding elements." << endl;
-        cout << endl << endl;
-
-        cout << "Type D6: " << endl;
-        D6.print_matrix(); cout << endl;
-        generate_all_elements_breadth_first(&D6, 0);
-        cout << "B6 has 1055 short-braid-avoiding elements." << endl;
-        cout << endl << endl;
-
-        cout << "Type D7: " << endl;
-        D7.print_matrix(); cout << endl;
-        generate_all_elements_breadth_first(&D7, 0);
-	cout << "D7 has 2144 short-braid-avoiding elements." << endl;
-        cout << endl << endl;
-
-	cout << "Type B3: " << endl;
-	B3.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&B3, 0);
-	cout << "B3 has 24 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type B4: " << endl;
-	B4.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&B4, 0);
-	cout << "B4 has 83 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type B5: " << endl;
-	B5.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&B5, 0);
-	cout << "B5 has 293 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type B6: " << endl;
-	B6.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&B6, 0);
-	cout << "B6 has 1055 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type B7: " << endl;
-	B7.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&B7, 0);
-	cout << "B7 has 3860 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type A8: " << endl;
-	A8.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&A8, 0);
-	cout << "A8 has 4862 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type A9: " << endl;
-	A9.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&A9, 0);
-	cout << "A9 has 16796 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type A10: " << endl;
-	A10.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&A10, 0);
-	cout << "A10 has 58786 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type D9 (excluding 1-line pattern {-1, 6, 7, 8, -5, 2, 3, 4, 9}): " << endl;
-	D9.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&D9, 0);
-	cout << "D9 has 29171 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-
-	cout << "Type D10 (excluding 1-line pattern {-1, 6, 7, 8, -5, 2, 3, 4, 9}): " << endl;
-	D10.print_matrix(); cout << endl;
-	generate_all_elements_breadth_first(&D10, 0);
-	cout << "D10 has 109173 short-braid-avoiding elements." << endl;
-	cout << endl << endl;
-*/
-}
-
+#include "CoxeterElement.h"
+#include "HeapEnumerator.h"
+#include "ElementIndex.h"
+#include "CayleyTable.h"
+#include "WGraph.h"
+#include "PatternSet.h"
+#include "ElementSet.h"
+#include "ElementFrontier.h"
+#include "CoxeterRegistry.h"
+#include "Masks.h"
+
+#include <fstream>
+#include <stdio.h>
+#include <string.h>
+
+/////////////////////////////////////////////////////////////////////
+//
+//  This is code which classifies the minimally non-Deodhar elements
+//  of various Coxeter groups.
+//  
+//  We also verify the "mu in {0,1}" property for 
+//  Deodhar elements of these Coxeter groups.
+//
+/////////////////////////////////////////////////////////////////////
+
+static const int DEBUG_VERBOSE_GEN = 0;
+static const int VERBOSE = 0;
+
+// Set by -table-threshold:  groups with at most this many elements use a CayleyTable in the mask loop (0 = never).
+static long long TABLE_THRESHOLD = CAYLEY_TABLE_DEFAULT_THRESHOLD;
+
+// Set by -symmetry:  only test the masks of one element per orbit of the group generated by diagram automorphisms and inversion.
+static int SYMMETRY_REDUCTION = 0;
+
+// Set by -wgraph <prefix>:  write the W-graph of the Deodhar elements of each type to <prefix><type>.wg.
+static string WGRAPH_PREFIX = "";
+
+// Set by -affine <length>:  also classify the affine types, up to this length.
+static int AFFINE_MAX_LENGTH = 0;
+
+// Set by -type <name>:  only classify this type (an infinite one up to the length given by -affine).
+static string TYPE_NAME = "";
+
+// Set by -checkpoint <file>:  with -type, save the state of the classification to <file> after each length, and with 
+// --resume, start from the state saved there.
+static string CHECKPOINT_FILE = "";
+static int RESUME = 0;
+
+// The bad 1-line patterns of type D are the D8 pattern {-1, 6, 7, 8, -5, 2, 3, 4} (pattern 0), followed by the patterns 
+// read from the file given by -patterns <file>, one per line.  Those of type B are read from -b-patterns <file> (there 
+// are none by default).  Elements of type D (or B) containing any of them are treated as non-Deodhar without testing 
+// their masks.
+static PatternSet D_ONE_LINE_PATTERNS;
+static PatternSet B_ONE_LINE_PATTERNS;
+static string PATTERNS_FILE = "";
+static string B_PATTERNS_FILE = "";
+
+// The Coxeter systems are built here on demand (verify does not use the static systems of CoxeterSystem.h).
+static CoxeterRegistry REGISTRY;
+
+// The bad 1-line patterns for the type of cs, or NULL if its elements have no signed one-line notation.
+PatternSet* get_one_line_patterns(CoxeterSystem* cs)
+{
+	if (cs->get_one_line_type() == 'D') { return &D_ONE_LINE_PATTERNS; }
+	if (cs->get_one_line_type() == 'B') { return &B_ONE_LINE_PATTERNS; }
+	return NULL;
+}
+
+// Above this order a group is not numbered by its ElementIndex ranks, since an IndexedElementSet would then hold 
+// one bit per element (2^26 bits are 8 MB, where D10 would need 232 MB and D12 122 GB).
+const long long RANKED_NUMBERS_LIMIT = 1 << 26;
+
+// Numbers the elements of a Coxeter group:  by their ElementIndex ranks when the group is finite and small enough, 
+// and otherwise in order of appearance (looked up by fingerprint in an ElementSet).
+class ElementNumbers
+{
+	public:
+		ElementIndex* index;
+		int ranked;  // 1 if the numbers are the ElementIndex ranks.
+		ElementSet numbers;  // the words of the elements numbered so far, when they are not ranked.
+		vector<int> identity_one_line;  // the elements in the ElementSet are rebuilt without a one-line notation.
+
+		ElementNumbers(ElementIndex* ei) : numbers(ei->coxeter_system->size), identity_one_line(ei->coxeter_system->size + 1)
+		{ 
+			index = ei;
+			ranked = (index->get_order() > 0 && index->get_order() <= RANKED_NUMBERS_LIMIT) ? 1 : 0;
+			for (int j = 0; j < identity_one_line.size(); j++) { identity_one_line[j] = j+1; }
+		}
+
+		long long get_count() { return (ranked == 1) ? index->get_order() : numbers.get_count(); }
+		long long rank(CoxeterElement& w) { return (ranked == 1) ? index->rank(w) : numbers.insert(w); }
+		long long find(CoxeterElement& w) { return (ranked == 1) ? index->rank(w) : numbers.find(w); }  // -1 if w was never numbered.
+		CoxeterElement unrank(long long r)
+		{
+			if (ranked == 1) { return index->unrank(r); }
+			return CoxeterElement(index->coxeter_system, &numbers.words[numbers.size * r], &identity_one_line[0]);
+		}
+};
+
+// A set of elements, stored as a bitset over their ElementNumbers.
+class IndexedElementSet
+{
+	public:
+		ElementNumbers* numbers;
+		vector<bool> bits;
+		long long count;
+
+		IndexedElementSet(ElementNumbers* en) : bits(en->get_count(), false) { numbers = en;  count = 0; }
+
+		int contains(CoxeterElement& w) { long long r = numbers->find(w);  return (r >= 0 && r < bits.size()) ? (int) bits[r] : 0; }
+		int insert(CoxeterElement& w)  // 1 if w was not in the set.
+		{ 
+			long long r = numbers->rank(w);
+			if (r < bits.size() && bits[r]) { return 0; }
+			insert_number(r);
+			return 1;
+		}
+		void insert_number(long long r) { if (r >= bits.size()) { bits.resize(2*r + 1, false); }  if (!bits[r]) { bits[r] = true;  count++; } }
+		long long size() { return count; }
+};
+
+// Checkpoint layout:  the header, the Coxeter matrix, and the elements of NON_DEODHAR_PATTERNS, as their ranks or (when 
+// ElementNumbers does not rank them) their words.  So the size grows with the number of non-Deodhar elements found, and
+// not with the order of the group.  The other numbered elements (the mu targets) only matter for the W-graph.
+static const char CHECKPOINT_MAGIC[8] = { 'V', 'E', 'R', 'I', 'F', 'Y', '1', 0 };
+
+struct CheckpointHeader
+{
+	char magic[8];
+	long long size;
+	long long numbers_width;  // sizeof(NUMBERS_DATATYPE).
+	long long symmetry;
+	long long max_length;  // the up-ideals stop at this length, so a resumed run must use the same one.
+	long long next_length;  // the first length not evaluated yet.
+	long long deodhar_count;
+	long long total_count;
+	long long mask_test_count;
+	long long ranked;  // ElementNumbers::ranked.
+	long long member_count;
+};
+
+// writes the state at the start of next_length to CHECKPOINT_FILE.tmp, and then renames it over CHECKPOINT_FILE, so 
+// that an interrupted save leaves the previous checkpoint in place.
+int save_checkpoint(CoxeterSystem* cs, int max_length, int next_length, int deodhar_count, int total_count, int mask_test_count, IndexedElementSet& set, ElementNumbers& numbers)
+{
+	string temporary = CHECKPOINT_FILE + ".tmp";
+	ofstream out(temporary.c_str(), ios::out | ios::binary);
+	if (!out) { cout << "ERROR:  cannot write " << temporary << "." << endl;  return 0; }
+
+	CheckpointHeader header;
+	memcpy(header.magic, CHECKPOINT_MAGIC, 8);
+	header.size = cs->size;
+	header.numbers_width = sizeof(NUMBERS_DATATYPE);
+	header.symmetry = SYMMETRY_REDUCTION;
+	header.max_length = max_length;
+	header.next_length = next_length;
+	header.deodhar_count = deodhar_count;
+	header.total_count = total_count;
+	header.mask_test_count = mask_test_count;
+	header.ranked = numbers.ranked;
+	header.member_count = set.size();
+
+	out.write((char*) &header, sizeof(CheckpointHeader));
+	out.write((char*) cs->coxeter_matrix, sizeof(int) * cs->size * cs->size);
+	for (long long r = 0; r < set.bits.size(); r++)
+	{
+		if (!set.bits[r]) { continue; }
+		if (numbers.ranked == 1) { out.write((char*) &r, sizeof(long long)); }
+		else { out.write((char*) &numbers.numbers.words[numbers.numbers.size * r], sizeof(NUMBERS_DATATYPE) * cs->size); }
+	}
+	out.close();
+	if (!out) { cout << "ERROR:  cannot write " << temporary << "." << endl;  return 0; }
+
+	if (rename(temporary.c_str(), CHECKPOINT_FILE.c_str()) != 0) { cout << "ERROR:  cannot replace " << CHECKPOINT_FILE << "." << endl;  return 0; }
+	return 1;
+}
+
+// reads the state saved by save_checkpoint() for cs into the (empty) set and numbers.  Returns 1 on success.
+int load_checkpoint(CoxeterSystem* cs, int max_length, int& next_length, int& deodhar_count, int& total_count, int& mask_test_count, IndexedElementSet& set, ElementNumbers& numbers)
+{
+	ifstream in(CHECKPOINT_FILE.c_str(), ios::in | ios::binary);
+	if (!in) { cout << "ERROR:  cannot read " << CHECKPOINT_FILE << "." << endl;  return 0; }
+
+	CheckpointHeader header;
+	in.read((char*) &header, sizeof(CheckpointHeader));
+	if (!in || memcmp(header.magic, CHECKPOINT_MAGIC, 8) != 0) { cout << "ERROR:  " << CHECKPOINT_FILE << " is not a verify checkpoint." << endl;  return 0; }
+	if (header.size != cs->size || header.numbers_width != sizeof(NUMBERS_DATATYPE) || header.symmetry != SYMMETRY_REDUCTION || header.ranked != numbers.ranked)
+	{ cout << "ERROR:  " << CHECKPOINT_FILE << " was saved for another type, NUMBERS_DATATYPE or -symmetry setting." << endl;  return 0; }
+	if (header.max_length != max_length)
+	{ cout << "ERROR:  " << CHECKPOINT_FILE << " was saved with -affine " << header.max_length << "." << endl;  return 0; }
+
+	vector<int> matrix(cs->size * cs->size);
+	in.read((char*) &matrix[0], sizeof(int) * matrix.size());
+	for (int i = 0; i < matrix.size(); i++)
+	{ if (matrix[i] != cs->coxeter_matrix[i]) { cout << "ERROR:  " << CHECKPOINT_FILE << " was saved for another type." << endl;  return 0; } }
+
+	set.bits.assign(numbers.get_count(), false);
+	set.count = 0;
+	NUMBERS_DATATYPE* word = new NUMBERS_DATATYPE[cs->size];
+	for (long long i = 0; i < header.member_count && in; i++)
+	{
+		long long r = 0;
+		if (numbers.ranked == 1) { in.read((char*) &r, sizeof(long long)); }
+		else
+		{
+			// elements that are not ranked are numbered again, in the order they were saved.
+			in.read((char*) word, sizeof(NUMBERS_DATATYPE) * cs->size);
+			CoxeterElement w = CoxeterElement(cs, word, &numbers.identity_one_line[0]);
+			r = numbers.rank(w);
+		}
+		if (in) { set.insert_number(r); }
+	}
+	delete[] word;
+	if (!in) { cout << "ERROR:  " << CHECKPOINT_FILE << " is truncated." << endl;  return 0; }
+
+	next_length = header.next_length;
+	deodhar_count = header.deodhar_count;
+	total_count = header.total_count;
+	mask_test_count = header.mask_test_count;
+	return 1;
+}
+
+// generates all the elements above t in the 2-weak order, puts them in PROCESSED_ELEMENTS.
+// The elements are found one length at a time, as the records of an ElementFrontier (which keeps its arrays from 
+// level to level), and each is put in PROCESSED_ELEMENTS as it is found, so that it is only pushed once.
+int generate_up_ideal(CoxeterElement& t, int max_length, IndexedElementSet& PROCESSED_ELEMENTS)
+{
+	if (max_length > 0 && t.length > max_length) { return 0; }
+
+	// see if t has already been processed
+	if ( PROCESSED_ELEMENTS.insert(t) == 0 ) { return 0; }
+
+	ElementFrontier level(t.coxeter_system);
+	ElementFrontier next_level(t.coxeter_system);
+	level.push(t);
+
+	// scratch elements, loaded from the frontier records.
+	CoxeterElement current = t;
+	CoxeterElement v = t;
+
+	while (level.get_count() > 0)
+	{
+	  for (long long k = 0; k < level.get_count(); k++)
+	  {
+		level.load(k, current);
+
+		if (DEBUG_VERBOSE_GEN)
+		{ cout << "adding "; current.print(); current.print_reduced_expression(); }
+
+		// hit current on the right with all possible generators, s.t. it is short-braid-avoiding
+		for (int i = 0; i < current.size; i++)
+		{
+		  if (current.word[i] > 0) 
+		  { 
+			// the heap state records how many non-commuting generators follow the last occurrence of i.
+			if ( current.right_extension_avoids_short_braid(i) )
+			{
+		    	  if (DEBUG_VERBOSE_GEN) { cout << "multiplying by " << i << " and adding to list." << endl; }
+			  level.load(k, v);
+			  v.right_multiply(i);
+			  if ( (max_length <= 0 || v.length <= max_length) && PROCESSED_ELEMENTS.insert(v) == 1 ) { next_level.push(v); }
+			}
+			else
+			{
+		    	  if (DEBUG_VERBOSE_GEN) { cout << "multiplying by " << i << " would create short-braid." << endl; }
+			}
+		  }
+		}
+
+		// hit current on the left with all possible generators, s.t. it is short-braid-avoiding
+		for (int i = 0; i < current.size; i++)
+		{
+			// the heap state records how many non-commuting generators precede the first occurrence of i.
+			if ( current.left_extension_avoids_short_braid(i) )
+			{
+		    	  if (DEBUG_VERBOSE_GEN) { cout << "left multiplying by " << i << " and adding to list." << endl; }
+			  level.load(k, v);
+			  v.left_multiply(i);
+			  if ( v.length > current.length && (max_length <= 0 || v.length <= max_length) && PROCESSED_ELEMENTS.insert(v) == 1 ) { next_level.push(v); }
+			}
+			else
+			{
+		    	  if (DEBUG_VERBOSE_GEN) { cout << "left multiplying by " << i << " would create short-braid." << endl; }
+			}
+		}
+	  }
+
+	  // the next level becomes this one, and the old records are dropped (keeping their arrays).
+	  level.swap(next_level);
+	  next_level.clear();
+	} // end while there are elements yet to process
+	return 0;
+}
+
+// runs Deodhar's mask test on current, recording the mu values of the mu-masks by the ranks of the indexed elements.
+// Returns 1 if current is Deodhar.
+int test_deodhar(CoxeterElement& current, int reduced[], map<long long, int>& mus, ElementNumbers* numbers, CayleyTable* table)
+{
+	CoxeterSystem* coxeter_system = current.coxeter_system;
+	int dt = 1;
+        Masks masks(current.length);
+        while (masks.exhausted() == 0)
+        {
+		if (!masks.proper()) { masks.next(); continue; }
+
+                // calculate the contribution of this mask to the Kazhdan-Lusztig basis element.
+                int defect_count = 0;
+                int tc_length = 0;
+                long long tc_rank = 0;  // only needed for mu masks.
+
+		if (table != NULL)
+		{
+                  // with a Cayley table, each multiplication and descent test is one lookup.
+                  long long tc = table->identity;
+                  for (int i = 0; i < current.length; i++)
+                  {
+                        if (masks.get_value(i) == 1)
+                        { tc = table->right_multiply(tc, reduced[i]); }
+
+                        if (i < current.length-1 && table->has_right_descent(tc, reduced[i+1]))
+                        { defect_count++; }
+                  }
+                  tc_length = table->get_length(tc);
+                  tc_rank = tc;
+		}
+		else
+		{
+                  CoxeterElement tc(coxeter_system);
+                  for (int i = 0; i < current.length; i++)
+                  {
+                        // build indexing element using 1-entries through this position i.
+                        if (masks.get_value(i) == 1)
+                        { tc.right_multiply(reduced[i]); }
+
+                        // see if this position is a defect:  is reduced_expression[i+1] a right descent for t?
+                        if (i < current.length-1 && tc.has_right_descent(reduced[i+1]))
+                        { defect_count++; }
+                  }
+                  tc_length = tc.get_length();
+                  if ((current.length - tc_length) - (2*defect_count) == 1) { tc_rank = numbers->rank(tc); }
+		}
+
+		// Check the Deodhar statistic:  1 = mu mask, 0 = not Deodhar.
+		int deodhar_statistic = (current.length - tc_length) - (2*defect_count);
+		if (deodhar_statistic <= 0 && masks.proper())
+		{
+			dt = 0;
+			break;
+		}
+
+		// Check for mu in {0, 1}.
+		if (deodhar_statistic == 1)
+		{
+				  // The current mask is a mu-mask, so update mu values.
+				  if (mus.find(tc_rank) != mus.end())
+				  {
+				     if(VERBOSE)
+				     {
+						cout << "WARNING:  0-1 mu property failed on: ";
+						string mm;
+						masks.sprint(mm);
+						cout << mm << endl;
+					//	print_reduced_expression();
+						cout << " (but this may be a non-Deodhar elt.)." << endl;
+				     }	
+				  }
+				  mus[ tc_rank ]++;
+		}
+
+                masks.next();
+        }
+
+	return dt;
+}
+
+// collects the orbit of w under the group generated by the diagram automorphisms and inversion.
+// All of these elements have the same length, and they are either all Deodhar or all non-Deodhar.
+void get_symmetry_orbit(CoxeterElement& w, vector<CoxeterElement>& orbit)
+{
+	orbit.clear();
+	orbit.push_back(w);
+
+	for (int i = 0; i < orbit.size(); i++)
+	{
+		// a = -1 is inversion, the others index the automorphism_group.
+		for (int a = -1; a < w.coxeter_system->automorphism_group_size; a++)
+		{
+			CoxeterElement v = orbit[i];
+			if (a < 0) { v.invert(); } else { v.apply_automorphism(a); }
+
+			int match_exists = 0;
+			for (int j = 0; j < orbit.size(); j++)
+			{
+				if ( v.equals(&(orbit[j])) == 1 ) { match_exists = 1; break; }
+			}
+			if (match_exists == 0) { orbit.push_back(v); }
+		}
+	}
+}
+
+// the canonical representative of an orbit is the element whose numbers game word is lexicographically smallest.
+int get_orbit_representative(vector<CoxeterElement>& orbit)
+{
+	int rep = 0;
+	for (int i = 1; i < orbit.size(); i++)
+	{
+		for (int j = 0; j < orbit[i].size; j++)
+		{
+			if (orbit[i].word[j] < orbit[rep].word[j]) { rep = i; break; }
+			if (orbit[i].word[j] > orbit[rep].word[j]) { break; }
+		}
+	}
+	return rep;
+}
+
+int generate_all_elements_breadth_first(CoxeterSystem* coxeter_system, int max_length)
+{
+	int deodhar_count = 0;  // Keep enumeration for futher directions section of paper.
+	int total_count = 0;    // This won't match the total # elts in group since elements above a bad pattern are never tested.
+	int mask_test_count = 0;  // number of elements that actually had their masks tested (one per orbit in SYMMETRY_REDUCTION mode).
+
+	ElementIndex index(coxeter_system);
+	ElementNumbers numbers(&index);
+	IndexedElementSet NON_DEODHAR_PATTERNS(&numbers);
+
+	CayleyTable* table = NULL;
+	if (numbers.ranked == 1 && index.get_order() <= TABLE_THRESHOLD) { table = new CayleyTable(&index); }  // the table ranks are the numbers.
+
+	WGraph wgraph(coxeter_system->size);
+	PatternSet* one_line_patterns = get_one_line_patterns(coxeter_system);
+
+	int start_length = 0;
+	if (RESUME == 1)
+	{
+		if (load_checkpoint(coxeter_system, max_length, start_length, deodhar_count, total_count, mask_test_count, NON_DEODHAR_PATTERNS, numbers) == 0)
+		{
+			if (table != NULL) { delete table; }
+			return 0;
+		}
+		cout << "  (resuming from " << CHECKPOINT_FILE << " at length " << start_length << ", with " << NON_DEODHAR_PATTERNS.size() << " non-Deodhar elements recorded...) " << endl;
+	}
+
+	// The short-braid-avoiding elements are produced one length at a time by HeapEnumerator, each exactly once,
+	// so no list of processed elements is kept.  Since they form an order ideal in the weak order, we can stop 
+	// at the first length having no elements.
+	for (int current_length = start_length; max_length <= 0 || current_length <= max_length; current_length++)
+	{
+		// everything below current_length is done, so this is a consistent place to save.
+		if (CHECKPOINT_FILE != "" && current_length > start_length)
+		{ save_checkpoint(coxeter_system, max_length, current_length, deodhar_count, total_count, mask_test_count, NON_DEODHAR_PATTERNS, numbers); }
+
+		cout << "  (evaluating length " << current_length << " elements, with " << total_count << " elements processed so far...) " << endl; 
+
+		HeapEnumerator heaps(coxeter_system, current_length);
+		int* heap_word = new int[current_length];
+		int found_at_length = 0;
+
+		while (heaps.next())
+		{
+			found_at_length++;
+			heaps.get_reduced_expression(heap_word);
+			CoxeterElement current = CoxeterElement(coxeter_system, heap_word, current_length);
+
+			// Elements above a non-Deodhar element are non-Deodhar by the lemma, and were recorded by generate_up_ideal.
+			if ( NON_DEODHAR_PATTERNS.contains(current) == 1 )
+			{
+				continue;
+			}
+
+			// In SYMMETRY_REDUCTION mode, the masks are only tested on the canonical representative of the orbit of current,
+			// and the whole orbit is processed when the enumeration reaches the representative.  (NON_DEODHAR_PATTERNS holds
+			// the automorphic images of its elements but not their inverses, so some other orbit elements may already be in it.)
+			vector<CoxeterElement> orbit;
+			if (SYMMETRY_REDUCTION) { get_symmetry_orbit(current, orbit); }
+			else { orbit.push_back(current); }
+			int rep = get_orbit_representative(orbit);
+			if (orbit[rep].equals(&current) == 0) { continue; }
+
+			int* rep_reduced = new int[current.length];
+			orbit[rep].get_reduced_expression(rep_reduced);
+
+			map<long long, int> mus;
+			int dt = test_deodhar(orbit[rep], rep_reduced, mus, &numbers, table);
+			mask_test_count++;
+			delete[] rep_reduced;
+
+		  	if ( dt == 1 ) 
+			{ 
+				// Print mu values.
+				if (VERBOSE) 
+				{
+	    			cout << "w = ";
+				orbit[rep].print_reduced_expression();
+				cout << endl;
+				}
+				map<long long, int>::iterator iter;   
+	  			for( iter = mus.begin(); iter != mus.end(); iter++ ) 
+				{
+				  if (VERBOSE || iter->second > 1)
+				  {
+				    CoxeterElement x = numbers.unrank(iter->first);
+				    string x_name;
+				    x.sprint_reduced_expression(x_name);
+				    if (iter->second > 1) { cout << "ERROR:  Found NON-01 MU VALUE:  ";  orbit[rep].print();  orbit[rep].print_reduced_expression(); }
+	    			    cout << "    mu = " << iter->second << " for x = " << x_name << endl;
+				  }
+				  if (WGRAPH_PREFIX != "") { wgraph.add_edge(iter->first, numbers.rank(orbit[rep]), iter->second); }
+	  			}
+			}
+
+			// Expand the orbit, so that the counts match the non-reduced enumeration, which skips the elements already known
+			// to be non-Deodhar.
+			for (int o = 0; o < orbit.size(); o++)
+			{
+				CoxeterElement& member = orbit[o];
+				if (o != rep && NON_DEODHAR_PATTERNS.contains(member) == 1) { continue; }
+
+				int* reduced = new int[member.length];
+				member.get_reduced_expression(reduced);
+
+				if (DEBUG_VERBOSE_GEN)
+				{ cout << "adding "; member.print(); member.print_reduced_expression(); }
+
+				total_count++;
+
+			  	if ( dt == 1 ) 
+				{ 
+					deodhar_count++; 
+					if (WGRAPH_PREFIX != "") { wgraph.add_vertex(member, numbers.rank(member)); }
+
+					// check the 1-line patterns of types B and D.  
+					if ( one_line_patterns != NULL && one_line_patterns->contains(member) )
+					{ cout << "ERROR:  cannot use 1-line patterns for Deodhar characterization:  "; member.print(); member.print_reduced_expression(); cout << endl; }
+				}
+
+			  	if (dt == 0)
+			  	{
+					if (VERBOSE) 
+					{ cout << "  Found non-Deodhar element:  ";  member.print();  member.print_reduced_expression(); }
+
+					int contains_pattern = 0;
+
+					// see if any patterns in NON_DEODHAR_PATTERN list are _equal_ to member.
+					contains_pattern = NON_DEODHAR_PATTERNS.contains(member);
+
+					// If not, add member, and add up-ideals in 2-weak order generated by member and it's Coxeter embeddings to NON_DEODHAR_PATTERN list.
+					if (contains_pattern == 0)
+					{
+						// check the 1-line patterns of types B and D (the D8 pattern can only be found in D8, D9 and D10).  
+						int one_line_match = -1;
+						if (one_line_patterns != NULL)
+						{
+							one_line_match = one_line_patterns->find(member);
+							if (one_line_match >= 0) { contains_pattern = 1; }
+						}
+
+						if (contains_pattern == 1)
+						{
+						  if (one_line_patterns == &D_ONE_LINE_PATTERNS && one_line_match == 0) { cout << "  (D8 1-line pattern found in "; }
+						  else 
+						  { 
+						    cout << "  (1-line pattern {";
+						    for (int i = 0; i < one_line_patterns->patterns[one_line_match].size(); i++) { cout << " " << one_line_patterns->patterns[one_line_match][i]; }
+						    cout << " } found in ";
+						  }
+						  member.print(); member.print_reduced_expression(); cout << " of rank " << member.get_rank(reduced) << ")" << endl;
+						}
+						else
+						{
+						  cout << "Found MINIMAL PATTERN of rank " << member.get_rank(reduced) << ":  ";  member.print();  cout << " "; member.print_reduced_expression();  cout << endl;
+						}
+
+						int rv = generate_up_ideal(member, max_length, NON_DEODHAR_PATTERNS);
+		
+						for (int i = 0; i < member.coxeter_system->automorphism_group_size; i++)
+						{
+					  		CoxeterElement v = CoxeterElement(member.coxeter_system);
+							if (VERBOSE) { cout << " adding related graph automorphic element:  "; }
+							for (int j = 0; j < member.length; j++)
+							{
+					  			v.right_multiply(member.coxeter_system->get_automorphism(i, reduced[j]));
+							}
+							if (VERBOSE) { v.print(); cout << endl; }
+
+							rv = generate_up_ideal(v, max_length, NON_DEODHAR_PATTERNS);
+						}
+					}
+
+					if (contains_pattern == 1 && VERBOSE)
+					{
+						cout << "  (contains previous pattern, so breaking)..." << endl;
+					}
+
+				}
+
+				delete[] reduced;
+			} // end for each element of the orbit
+		} // end while there are heaps of this length
+
+		delete[] heap_word;
+		if (found_at_length == 0) { break; }
+	} // end for each length
+
+	cout << "Finished:  found " << deodhar_count << " Deodhar elements (out of " << total_count << " short-braid-avoiding elements processed, used " << NON_DEODHAR_PATTERNS.size() << " non-Deodhar patterns).  Also verified mu in {0,1} property for these Deodhar elements (check stdout for errors)." << endl;
+
+	if (SYMMETRY_REDUCTION)
+	{ cout << "  (Symmetry reduction:  tested masks on " << mask_test_count << " orbit representatives.)" << endl; }
+
+        if (VERBOSE)
+        { for (long long r = 0; r < NON_DEODHAR_PATTERNS.bits.size(); r++) { if (NON_DEODHAR_PATTERNS.bits[r]) { CoxeterElement p = numbers.unrank(r);  p.print(); p.print_reduced_expression(); cout << endl; } } }
+
+	if (coxeter_system->overflow_count > 0)
+	{ cout << "ERROR:  " << coxeter_system->overflow_count << " numbers game moves overflowed, so these counts are not reliable." << endl; }
+
+	cout << "  (Consistency:  check that #short-braid-avoiding elts = " << (NON_DEODHAR_PATTERNS.size() + deodhar_count) <<  " = total non-Deodhar elts + Deodhar elts.)" << endl;
+
+	if (WGRAPH_PREFIX != "")
+	{
+		string filename = WGRAPH_PREFIX + REGISTRY.get_name(coxeter_system) + ".wg";
+
+		wgraph.build();
+		if (wgraph.save(filename.c_str()) == 1)
+		{ cout << "  (Wrote the W-graph of the Deodhar elements to " << filename << ":  " << wgraph.vertex_count << " vertices, " << (wgraph.edge_count / 2) << " edges.)" << endl; }
+	}
+	cout << endl;
+
+	if (table != NULL) { delete table; }
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	/////////////////////////////////////////////////////////////
+	//
+	// Here are # fully-commutative elts in ranks 2 - 14:  (See Stembridge for details.)
+	// Type A:  {5,14,42,132,429,1430,4862,16796,58786,208012,742900,2674440,9694845}
+	// Type B:  {7,24,83,293,1055,3860,14299,53481,201551,764217,2912167,11143499,42791039}
+	// Type D:  {4,14,48,167,593,2144,7864,29171,109173,411501,1560089,5943199,22732739}
+	// Type E:
+	//   E6:  662
+	//   E7:  2670
+	//   E8:  10846
+	//
+	/////////////////////////////////////////////////////////////
+
+	for (int i = 1; i < argc; i++)
+	{
+		string a = argv[i];
+		if (a == "-symmetry") { SYMMETRY_REDUCTION = 1; }
+		else if (a == "-table-threshold" && i+1 < argc) { i++; TABLE_THRESHOLD = atoll(argv[i]); }
+		else if (a == "-wgraph" && i+1 < argc) { i++; WGRAPH_PREFIX = argv[i]; }
+		else if (a == "-affine" && i+1 < argc) { i++; AFFINE_MAX_LENGTH = atoi(argv[i]); }
+		else if (a == "-patterns" && i+1 < argc) { i++; PATTERNS_FILE = argv[i]; }
+		else if (a == "-b-patterns" && i+1 < argc) { i++; B_PATTERNS_FILE = argv[i]; }
+		else if (a == "-type" && i+1 < argc) { i++; TYPE_NAME = argv[i]; }
+		else if (a == "-checkpoint" && i+1 < argc) { i++; CHECKPOINT_FILE = argv[i]; }
+		else if (a == "--resume") { RESUME = 1; }
+	}
+
+	// initialization of bad D8 1-line pattern:
+	int D8_PATTERN_OL[9] = { -1, 6, 7, 8, -5, 2, 3, 4, 9}; NUMBERS_DATATYPE D8_PATTERN_W[8] = {5, 5, 1, 1, -11, 5, 1, 1};
+	CoxeterElement D8_PATTERN = CoxeterElement(REGISTRY.get("D8"), D8_PATTERN_W, D8_PATTERN_OL); 
+	D_ONE_LINE_PATTERNS.add(D8_PATTERN);
+	if (PATTERNS_FILE != "")
+	{
+		if (D_ONE_LINE_PATTERNS.load(PATTERNS_FILE) < 0) { return 0; }
+		cout << "Type D one-line patterns:  " << endl;
+		D_ONE_LINE_PATTERNS.print();
+	}
+	if (B_PATTERNS_FILE != "")
+	{
+		if (B_ONE_LINE_PATTERNS.load(B_PATTERNS_FILE) < 0) { return 0; }
+		cout << "Type B one-line patterns:  " << endl;
+		B_ONE_LINE_PATTERNS.print();
+	}
+
+	// the W-graph needs the mu-coefficients of every element, not just of the orbit representatives.
+	if (SYMMETRY_REDUCTION && WGRAPH_PREFIX != "")
+	{ cout << "(Ignoring -symmetry, since -wgraph needs the mu-coefficients of every element.)" << endl;  SYMMETRY_REDUCTION = 0; }
+
+	// a checkpoint holds the state of one type, and not its W-graph.
+	if (CHECKPOINT_FILE != "" && TYPE_NAME == "")
+	{ cout << "(Ignoring -checkpoint, which needs -type.)" << endl;  CHECKPOINT_FILE = "";  RESUME = 0; }
+	if (RESUME == 1 && CHECKPOINT_FILE == "")
+	{ cout << "(Ignoring --resume, which needs -checkpoint <file>.)" << endl;  RESUME = 0; }
+	if (CHECKPOINT_FILE != "" && WGRAPH_PREFIX != "")
+	{ cout << "(Ignoring -wgraph, since the checkpoints do not hold the W-graph.)" << endl;  WGRAPH_PREFIX = ""; }
+
+	/////////////////////////////////////////////////////////////
+	//  A single type, given by -type.
+	/////////////////////////////////////////////////////////////
+
+	if (TYPE_NAME != "")
+	{
+		// the registry builds any rank, and reads matrix files.
+		CoxeterSystem* coxeter_system = REGISTRY.get(TYPE_NAME);
+		if (coxeter_system == NULL) { cout << "Coxeter type not supported." << endl;  return 0; }
+
+		int max_length = 0;
+		if (coxeter_system->is_finite() == 0)
+		{
+			if (AFFINE_MAX_LENGTH <= 0) { cout << "This group is infinite:  give a length with -affine <length>." << endl;  return 0; }
+			max_length = AFFINE_MAX_LENGTH;
+		}
+
+		cout << "Type " << TYPE_NAME << ": " << endl;
+		coxeter_system->print_matrix(); cout << endl;
+		generate_all_elements_breadth_first(coxeter_system, max_length);
+		return 0;
+	}
+
+	/////////////////////////////////////////////////////////////
+	//  Finite exceptional types.
+	/////////////////////////////////////////////////////////////
+
+	cout << "Type G2: " << endl;
+	REGISTRY.get("G2")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("G2"), 0);
+	cout << "G2 has 5 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type F4: " << endl;
+	REGISTRY.get("F4")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("F4"), 0);
+	cout << "F4 has 42 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type H3: " << endl;
+	REGISTRY.get("H3")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("H3"), 0);
+	cout << "H3 has 14 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type H4: " << endl;
+	REGISTRY.get("H4")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("H4"), 0);
+	cout << "H4 has 42 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	/////////////////////////////////////////////////////////////
+	//  Minimally non-Deodhar families.
+	/////////////////////////////////////////////////////////////
+
+	cout << endl << "Minimal non-Deodhar embedded factor patterns: " << endl;;
+
+	cout << "Generating minimal patterns for A7 (includes linear types BC, F4, G2, H3, H4): " << endl;
+	REGISTRY.get("A7")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("A7"), 0);
+	cout << "A7 has 1430 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Generating minimal patterns for D8 (excluding 1-line pattern {-1, 6, 7, 8, -5, 2, 3, 4, 9}): " << endl;
+	REGISTRY.get("D8")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("D8"), 0);
+	cout << "D8 has 7864 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Generating minimal patterns for E7: " << endl;
+	REGISTRY.get("E7")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("E7"), 0);
+	cout << "E7 has 2670 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	/////////////////////////////////////////////////////////////
+	//  Affine types, up to the length given by -affine.
+	/////////////////////////////////////////////////////////////
+
+	if (AFFINE_MAX_LENGTH > 0)
+	{
+		string affine_names[] = { "A~3", "A~4", "C~3", "D~4" };
+		for (int i = 0; i < 4; i++)
+		{
+			CoxeterSystem* affine = REGISTRY.get(affine_names[i]);
+			cout << "Type " << affine_names[i] << " (up to length " << AFFINE_MAX_LENGTH << "): " << endl;
+			affine->print_matrix(); cout << endl;
+			generate_all_elements_breadth_first(affine, AFFINE_MAX_LENGTH);
+			cout << endl << endl;
+		}
+	}
+
+	/////////////////////////////////////////////////////////////
+	//
+	//  Some (optional) checks for other types
+	//
+	/////////////////////////////////////////////////////////////
+
+/*
+	cout << endl << "Enumerative data and consistency checks: " << endl;;
+
+        cout << "Type E6: " << endl;
+        REGISTRY.get("E6")->print_matrix(); cout << endl;
+        generate_all_elements_breadth_first(REGISTRY.get("E6"), 0);
+        cout << "E6 has 24 short-braid-avoiding elements." << endl;
+        cout << endl << endl;
+
+	cout << "Type E8: " << endl;
+	REGISTRY.get("E8")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("E8"), 0);
+	cout << "E8 has 10846 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+        cout << "Type D3: " << endl;
+        REGISTRY.get("D3")->print_matrix(); cout << endl;
+        generate_all_elements_breadth_first(REGISTRY.get("D3"), 0);
+        cout << "D3 has 24 short-braid-avoiding elements." << endl;
+        cout << endl << endl;
+
+        cout << "Type D4: " << endl;
+        REGISTRY.get("D4")->print_matrix(); cout << endl;
+        generate_all_elements_breadth_first(REGISTRY.get("D4"), 0);
+        cout << "D4 has 83 short-braid-avoiding elements." << endl;
+        cout << endl << endl;
+
+        cout << "Type D5: " << endl;
+        REGISTRY.get("D5")->print_matrix(); cout << endl;
+        generate_all_elements_breadth_first(REGISTRY.get("D5"), 0);
+        cout << "D5 has 293 short-braid-avoiding elements." << endl;
+        cout << endl << endl;
+
+        cout << "Type D6: " << endl;
+        REGISTRY.get("D6")->print_matrix(); cout << endl;
+        generate_all_elements_breadth_first(REGISTRY.get("D6"), 0);
+        cout << "B6 has 1055 short-braid-avoiding elements." << endl;
+        cout << endl << endl;
+
+        cout << "Type D7: " << endl;
+        REGISTRY.get("D7")->print_matrix(); cout << endl;
+        generate_all_elements_breadth_first(REGISTRY.get("D7"), 0);
+	cout << "D7 has 2144 short-braid-avoiding elements." << endl;
+        cout << endl << endl;
+
+	cout << "Type B3: " << endl;
+	REGISTRY.get("B3")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("B3"), 0);
+	cout << "B3 has 24 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type B4: " << endl;
+	REGISTRY.get("B4")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("B4"), 0);
+	cout << "B4 has 83 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type B5: " << endl;
+	REGISTRY.get("B5")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("B5"), 0);
+	cout << "B5 has 293 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type B6: " << endl;
+	REGISTRY.get("B6")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("B6"), 0);
+	cout << "B6 has 1055 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type B7: " << endl;
+	REGISTRY.get("B7")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("B7"), 0);
+	cout << "B7 has 3860 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type A8: " << endl;
+	REGISTRY.get("A8")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("A8"), 0);
+	cout << "A8 has 4862 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type A9: " << endl;
+	REGISTRY.get("A9")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("A9"), 0);
+	cout << "A9 has 16796 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type A10: " << endl;
+	REGISTRY.get("A10")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("A10"), 0);
+	cout << "A10 has 58786 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type D9 (excluding 1-line pattern {-1, 6, 7, 8, -5, 2, 3, 4, 9}): " << endl;
+	REGISTRY.get("D9")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("D9"), 0);
+	cout << "D9 has 29171 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+
+	cout << "Type D10 (excluding 1-line pattern {-1, 6, 7, 8, -5, 2, 3, 4, 9}): " << endl;
+	REGISTRY.get("D10")->print_matrix(); cout << endl;
+	generate_all_elements_breadth_first(REGISTRY.get("D10"), 0);
+	cout << "D10 has 109173 short-braid-avoiding elements." << endl;
+	cout << endl << endl;
+*/
+}
+